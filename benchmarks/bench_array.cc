@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../my_array.h"
+#include "../my_vector.h"
+
+namespace {
+
+double sink = 0;
+
+// The array as it was before the elements moved inline: a heap block per
+// array, allocated by every constructor.
+class HeapVec4 {
+ public:
+  HeapVec4() : data_(new float[4]()) {}
+  HeapVec4(float x, float y, float z, float w) : HeapVec4() {
+    data_[0] = x;
+    data_[1] = y;
+    data_[2] = z;
+    data_[3] = w;
+  }
+  HeapVec4(const HeapVec4 &v) : HeapVec4() {
+    for (int i = 0; i < 4; ++i) data_[i] = v.data_[i];
+  }
+  HeapVec4 &operator=(const HeapVec4 &v) {
+    for (int i = 0; i < 4; ++i) data_[i] = v.data_[i];
+    return *this;
+  }
+  ~HeapVec4() { delete[] data_; }
+
+  float operator[](int pos) const { return data_[pos]; }
+
+ private:
+  float *data_;
+};
+
+using Vec4 = mycontainers::array<float, 4>;
+
+Vec4 makePoint(float x) { return Vec4{x, 1, 2, 1}; }
+HeapVec4 makeHeapPoint(float x) { return HeapVec4(x, 1, 2, 1); }
+
+double seconds(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Fills a vector with count points, then sums their dot products with a
+// fixed point; prints ns per point for the fill and for one pass.
+template <class Point, class Make>
+void run(const char *name, long count, Make make) {
+  auto start = std::chrono::steady_clock::now();
+  mycontainers::vector<Point> points;
+  points.reserve(count);
+  for (long i = 0; i < count; ++i) points.push_back(make(float(i % 100)));
+  double fill = seconds(start);
+
+  start = std::chrono::steady_clock::now();
+  double total = 0;
+  for (int pass = 0; pass < 10; ++pass) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      const Point &p = points[i];
+      total += p[0] * 0.5f + p[1] * 0.25f + p[2] * 2.0f + p[3];
+    }
+  }
+  double sum = seconds(start) / 10;
+  sink += total;
+  std::printf("%-20s %12.2f %12.2f\n", name, fill * 1e9 / double(count),
+              sum * 1e9 / double(count));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+  std::printf("vector of 4-float points, ns per point\n");
+  std::printf("%-20s %12s %12s\n", "point type", "fill", "dot pass");
+  run<HeapVec4>("heap array", count, makeHeapPoint);
+  run<Vec4>("inline array", count, makePoint);
+  return sink == 42 ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../my_blocking_queue.h"
+#include "../my_queue.h"
+
+namespace {
+
+const int kProducers = 2;
+const int kConsumers = 4;
+
+// The worker pool queue as it is today: MyQueue, a mutex and a condition
+// variable notified once per element.
+class LockedQueue {
+ public:
+  void push(int value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    notEmpty_.notify_one();
+  }
+  bool pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notEmpty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    notEmpty_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  mycontainers::MyQueue<int> queue_;
+  bool closed_ = false;
+};
+
+struct Result {
+  double mops;
+  double locksPerItem;
+};
+
+template <class Queue, class Produce, class Consume>
+Result run(Queue &queue, int count, Produce produce, Consume consume) {
+  std::atomic<long> sum{0};
+  std::atomic<long> locks{0};
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      long calls = 0;
+      sum += consume(queue, calls);
+      locks += calls;
+    });
+  }
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&, p] {
+      long calls = 0;
+      produce(queue, p, count, calls);
+      locks += calls;
+    });
+  }
+  for (int p = 0; p < kProducers; ++p) threads[kConsumers + p].join();
+  queue.close();
+  for (int c = 0; c < kConsumers; ++c) threads[c].join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (sum != long(count) * (count - 1) / 2) std::printf("checksum mismatch\n");
+  return {count / elapsed.count() / 1e6, double(locks) / count};
+}
+
+Result locked(int count) {
+  LockedQueue queue;
+  return run(
+      queue, count,
+      [](LockedQueue &q, int p, int n, long &calls) {
+        for (int i = p; i < n; i += kProducers, ++calls) q.push(i);
+      },
+      [](LockedQueue &q, long &calls) {
+        long sum = 0;
+        for (int value;;) {
+          ++calls;
+          if (!q.pop(value)) return sum;
+          sum += value;
+        }
+      });
+}
+
+Result batched(int count, int batch, size_t capacity) {
+  mycontainers::blocking_queue<int> queue(capacity);
+  return run(
+      queue, count,
+      [batch](mycontainers::blocking_queue<int> &q, int p, int n,
+              long &calls) {
+        std::vector<int> values;
+        for (int i = p; i < n; i += kProducers) {
+          values.push_back(i);
+          if (int(values.size()) == batch) {
+            q.push_batch(values.begin(), values.size());
+            values.clear();
+            ++calls;
+          }
+        }
+        q.push_batch(values.begin(), values.size());
+        ++calls;
+      },
+      [batch](mycontainers::blocking_queue<int> &q, long &calls) {
+        std::vector<int> values(batch);
+        long sum = 0;
+        for (;;) {
+          size_t n = q.pop_batch(values.begin(), values.size());
+          ++calls;
+          if (!n) break;
+          for (size_t i = 0; i < n; ++i) sum += values[i];
+        }
+        return sum;
+      });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 4000000;
+
+  std::printf("%d producers, %d consumers, %u CPUs\n", kProducers, kConsumers,
+              std::thread::hardware_concurrency());
+  std::printf("%-34s %10s %12s\n", "queue", "Mops/s", "locks/item");
+  Result result = locked(count);
+  std::printf("%-34s %10.2f %12.3f\n", "MyQueue + mutex, per item",
+              result.mops, result.locksPerItem);
+  for (int batch : {1, 16, 64}) {
+    for (size_t capacity : {size_t(0), size_t(1024)}) {
+      char name[64];
+      std::snprintf(name, sizeof(name), "blocking_queue batch %d, %s", batch,
+                    capacity ? "cap 1024" : "unbounded");
+      result = batched(count, batch, capacity);
+      std::printf("%-34s %10.2f %12.3f\n", name, result.mops,
+                  result.locksPerItem);
+    }
+  }
+  return 0;
+}
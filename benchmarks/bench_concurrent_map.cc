@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../my_concurrent_map.h"
+#include "../my_map.h"
+
+namespace {
+
+const int kKeyRange = 1 << 16;
+
+std::atomic<long> sink{0};
+
+class LockedMap {
+ public:
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  bool insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.insert(key, value).second;
+  }
+  bool erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    map_.erase(it);
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  mycontainers::MyMap<int, int> map_;
+};
+
+std::uint32_t nextRandom(std::uint32_t &state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+template <class Map>
+double run(int threads, int readPercent, int opsPerThread) {
+  Map map;
+  for (int key = 0; key < kKeyRange; key += 2) map.insert(key, key);
+
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t, readPercent, opsPerThread] {
+      std::uint32_t state = 2463534242u + t * 7919u;
+      long hits = 0;
+      for (int i = 0; i < opsPerThread; ++i) {
+        int op = nextRandom(state) % 100;
+        int key = nextRandom(state) % kKeyRange;
+        if (op < readPercent) {
+          hits += map.contains(key);
+        } else if (op % 2) {
+          hits += map.insert(key, key);
+        } else {
+          hits += map.erase(key);
+        }
+      }
+      sink += hits;
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return threads * double(opsPerThread) / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int opsPerThread = argc > 1 ? std::atoi(argv[1]) : 200000;
+  int maxThreads = argc > 2 ? std::atoi(argv[2])
+                            : int(std::thread::hardware_concurrency());
+  maxThreads = std::max(maxThreads, 1);
+
+  std::printf("concurrent_map vs MyMap + std::mutex, Mops/s\n");
+  std::printf("%-12s %8s %16s %16s\n", "mix", "threads", "concurrent_map",
+              "MyMap+mutex");
+  const struct {
+    const char *name;
+    int readPercent;
+  } mixes[] = {{"read-heavy", 90}, {"write-heavy", 20}};
+  for (auto &mix : mixes) {
+    for (int threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+      double lockFree =
+          run<mycontainers::concurrent_map<int, int>>(threads, mix.readPercent,
+                                                      opsPerThread);
+      double locked = run<LockedMap>(threads, mix.readPercent, opsPerThread);
+      std::printf("%-12s %8d %16.2f %16.2f\n", mix.name, threads, lockFree,
+                  locked);
+      if (threads == maxThreads) break;
+    }
+  }
+  return 0;
+}
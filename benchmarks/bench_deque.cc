@@ -0,0 +1,99 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <string>
+
+#include "../my_deque.h"
+#include "../my_list.h"
+
+namespace {
+
+long sink = 0;
+
+template <class Function>
+double nsPerItem(long count, Function function) {
+  auto start = std::chrono::steady_clock::now();
+  function();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / double(count);
+}
+
+// Pushes count elements at the front, then pops them from the back.
+template <class Deque>
+double frontToBack(long count) {
+  return nsPerItem(count, [count] {
+    Deque deque;
+    for (long i = 0; i < count; ++i) deque.push_front(int(i));
+    long total = 0;
+    while (!deque.empty()) {
+      total += deque.back();
+      deque.pop_back();
+    }
+    sink += total;
+  });
+}
+
+// Pushes and pops at both ends in turn, keeping depth elements.
+template <class Deque>
+double bothEnds(long count, int depth) {
+  Deque deque;
+  for (int i = 0; i < depth; ++i) deque.push_back(i);
+  return nsPerItem(count, [&deque, count] {
+    long total = 0;
+    for (long i = 0; i < count; ++i) {
+      if (i & 1) {
+        deque.push_front(int(i));
+        total += deque.back();
+        deque.pop_back();
+      } else {
+        deque.push_back(int(i));
+        total += deque.front();
+        deque.pop_front();
+      }
+    }
+    sink += total;
+  });
+}
+
+// Sums the elements by index in a scattered order.
+template <class Deque>
+double randomAccess(long count) {
+  Deque deque;
+  for (long i = 0; i < count; ++i) deque.push_back(int(i));
+  return nsPerItem(count, [&deque, count] {
+    long total = 0;
+    size_t pos = 0;
+    for (long i = 0; i < count; ++i) {
+      pos = (pos + 7919) % size_t(count);
+      total += deque[pos];
+    }
+    sink += total;
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+  using MyDeque = mycontainers::deque<int>;
+  using MyList = mycontainers::list<int>;
+  using StdDeque = std::deque<int>;
+  std::printf("deque vs list and std::deque, ns per element\n");
+  std::printf("%-24s %12s %12s %12s\n", "workload", "list", "deque",
+              "std::deque");
+  std::printf("%-24s %12.2f %12.2f %12.2f\n", "push_front burst",
+              frontToBack<MyList>(count), frontToBack<MyDeque>(count),
+              frontToBack<StdDeque>(count));
+  for (int depth : {16, 100000}) {
+    std::string name = "both ends, depth " + std::to_string(depth);
+    std::printf("%-24s %12.2f %12.2f %12.2f\n", name.c_str(),
+                bothEnds<MyList>(count, depth), bothEnds<MyDeque>(count, depth),
+                bothEnds<StdDeque>(count, depth));
+  }
+  std::printf("%-24s %12s %12.2f %12.2f\n", "random access", "-",
+              randomAccess<MyDeque>(count), randomAccess<StdDeque>(count));
+  return sink == 42 ? 1 : 0;
+}
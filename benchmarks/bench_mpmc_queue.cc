@@ -0,0 +1,109 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../my_mpmc_queue.h"
+#include "../my_queue.h"
+
+namespace {
+
+using MpmcQueue = mycontainers::mpmc_queue<int>;
+
+// Bounded MyQueue behind a mutex and two condition variables.
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this] { return queue_.size() < capacity_; });
+    queue_.push(value);
+    lock.unlock();
+    notEmpty_.notify_one();
+  }
+  void pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notEmpty_.wait(lock, [this] { return !queue_.empty(); });
+    out = queue_.front();
+    queue_.pop();
+    lock.unlock();
+    notFull_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  mycontainers::MyQueue<int> queue_;
+  size_t capacity_;
+};
+
+struct Locked {
+  static LockedQueue *create() { return new LockedQueue(1024); }
+};
+template <MpmcQueue::wait_mode Mode>
+struct Mpmc {
+  static MpmcQueue *create() { return new MpmcQueue(1024, Mode); }
+};
+
+// Producers push count values between them, consumers pop until they see
+// a -1; returns million values per second.
+template <class Factory>
+double run(int producers, int consumers, int count) {
+  auto *queue = Factory::create();
+  std::atomic<long> sum{0};
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([queue, &sum] {
+      long local = 0;
+      for (int value;;) {
+        queue->pop(value);
+        if (value < 0) break;
+        local += value;
+      }
+      sum += local;
+    });
+  }
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([queue, p, producers, count] {
+      for (int i = p; i < count; i += producers) queue->push(i);
+    });
+  }
+  for (int p = 0; p < producers; ++p) threads[consumers + p].join();
+  for (int c = 0; c < consumers; ++c) queue->push(-1);
+  for (int c = 0; c < consumers; ++c) threads[c].join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  delete queue;
+  if (sum != long(count) * (count - 1) / 2) std::printf("checksum mismatch\n");
+  return count / elapsed.count() / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? std::atoi(argv[1]) : 2000000;
+
+  std::printf("mpmc_queue vs mutex-guarded MyQueue, Mops/s, %u CPUs\n",
+              std::thread::hardware_concurrency());
+  std::printf("%-12s %12s %12s %12s\n", "prod/cons", "locked", "mpmc spin",
+              "mpmc futex");
+  for (int producers : {1, 2, 4}) {
+    for (int consumers : {1, 2, 4}) {
+      char name[16];
+      std::snprintf(name, sizeof(name), "%d/%d", producers, consumers);
+      std::printf(
+          "%-12s %12.2f %12.2f %12.2f\n", name,
+          run<Locked>(producers, consumers, count),
+          run<Mpmc<MpmcQueue::wait_mode::spin>>(producers, consumers, count),
+          run<Mpmc<MpmcQueue::wait_mode::futex>>(producers, consumers, count));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "../my_multiset.h"
+#include "../my_priority_queue.h"
+
+namespace {
+
+using Timer = std::int64_t;
+
+// The scheduler's current emulation: the earliest timer is the multiset's
+// first element.
+class MultisetQueue {
+ public:
+  Timer top() const { return queue_.begin()->first; }
+  bool empty() const { return queue_.empty(); }
+  void push(Timer value) { queue_.insert(value); }
+  void pop() { queue_.erase(queue_.begin()); }
+
+ private:
+  mycontainers::MyMultiset<Timer> queue_;
+};
+
+template <size_t D>
+using HeapQueue = mycontainers::priority_queue<Timer, std::greater<Timer>, D>;
+using StdQueue =
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>>;
+
+double elapsedNs(std::chrono::steady_clock::time_point start, long ops) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / double(ops);
+}
+
+// Keeps pending timers queued; each step fires the earliest one and
+// schedules a new timer a random delay later. Returns ns per step.
+template <class Queue>
+double schedule(int pending, long steps, Timer &checksum) {
+  std::mt19937 rng(1);
+  Queue queue;
+  for (int i = 0; i < pending; ++i) queue.push(Timer(rng() % 1000000));
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < steps; ++i) {
+    Timer now = queue.top();
+    queue.pop();
+    checksum += now;
+    queue.push(now + Timer(rng() % 1000000));
+  }
+  return elapsedNs(start, steps);
+}
+
+// Builds a queue of the given timers by pushing them one by one, or in
+// one push_range call for the heaps. Returns ns per element, the best of
+// three runs, as the first large allocation after another container is
+// freed is sometimes much slower.
+template <class Queue>
+double build(const std::vector<Timer> &values, bool range, Timer &checksum) {
+  double best = 0;
+  for (int run = 0; run < 3; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    Queue queue;
+    if constexpr (!std::is_same_v<Queue, MultisetQueue> &&
+                  !std::is_same_v<Queue, StdQueue>) {
+      if (range) queue.push_range(values.data(), values.data() + values.size());
+    }
+    if (queue.empty()) {
+      for (Timer value : values) queue.push(value);
+    }
+    double result = elapsedNs(start, long(values.size()));
+    if (!run || result < best) best = result;
+    checksum += queue.top();
+  }
+  return best;
+}
+
+}  // namespace
+
+int main() {
+  Timer checksum = 0;
+  std::printf("priority_queue vs MyMultiset emulation, ns per operation\n");
+  std::printf("%-22s %10s %10s %10s %10s\n", "workload", "multiset",
+              "heap D=2", "heap D=4", "std");
+  for (int pending : {1000, 100000, 1000000}) {
+    long steps = 2000000;
+    char name[32];
+    std::snprintf(name, sizeof(name), "schedule %d", pending);
+    std::printf("%-22s %10.1f %10.1f %10.1f %10.1f\n", name,
+                schedule<MultisetQueue>(pending, steps, checksum),
+                schedule<HeapQueue<2>>(pending, steps, checksum),
+                schedule<HeapQueue<4>>(pending, steps, checksum),
+                schedule<StdQueue>(pending, steps, checksum));
+  }
+  std::mt19937 rng(2);
+  std::vector<Timer> values(1000000);
+  for (Timer &value : values) value = Timer(rng());
+  std::printf("%-22s %10.1f %10.1f %10.1f %10.1f\n", "build, push each",
+              build<MultisetQueue>(values, false, checksum),
+              build<HeapQueue<2>>(values, false, checksum),
+              build<HeapQueue<4>>(values, false, checksum),
+              build<StdQueue>(values, false, checksum));
+  std::printf("%-22s %10s %10.1f %10.1f %10s\n", "build, push_range", "-",
+              build<HeapQueue<2>>(values, true, checksum),
+              build<HeapQueue<4>>(values, true, checksum), "-");
+  std::printf("checksum %lld\n", static_cast<long long>(checksum));
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../my_list.h"
+#include "../my_queue.h"
+
+namespace {
+
+std::atomic<long> sink{0};
+
+// The queue as it was before the ring buffer: a list pushed at the back
+// and popped at the front.
+class ListQueue {
+ public:
+  int front() const { return c_.front(); }
+  bool empty() const { return c_.empty(); }
+  void push(int value) { c_.push_back(value); }
+  void pop() { c_.pop_front(); }
+
+ private:
+  mycontainers::list<int> c_;
+};
+
+// Pushes count elements and pops them all; returns ns per push and pop.
+template <class Queue>
+double burst(long count) {
+  Queue queue;
+  long total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < count; ++i) queue.push(int(i));
+  while (!queue.empty()) {
+    total += queue.front();
+    queue.pop();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  sink += total;
+  return elapsed.count() * 1e9 / double(count);
+}
+
+// Keeps depth elements queued while count elements pass through.
+template <class Queue>
+double steady(long count, int depth) {
+  Queue queue;
+  for (int i = 0; i < depth; ++i) queue.push(i);
+  long total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < count; ++i) {
+    queue.push(int(i));
+    total += queue.front();
+    queue.pop();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  sink += total;
+  return elapsed.count() * 1e9 / double(count);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  long count = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+  std::printf("MyQueue (ring_buffer) vs list-backed queue, ns per push+pop\n");
+  std::printf("%-16s %12s %12s\n", "workload", "list", "ring_buffer");
+  std::printf("%-16s %12.2f %12.2f\n", "burst", burst<ListQueue>(count),
+              burst<mycontainers::MyQueue<int>>(count));
+  for (int depth : {16, 4096}) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "steady depth %d", depth);
+    std::printf("%-16s %12.2f %12.2f\n", name, steady<ListQueue>(count, depth),
+                steady<mycontainers::MyQueue<int>>(count, depth));
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../my_set.h"
+#include "../my_skiplist_set.h"
+
+namespace {
+
+std::atomic<long> sink{0};
+
+std::uint32_t nextRandom(std::uint32_t &state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+double elapsedNs(std::chrono::steady_clock::time_point start, long ops) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / double(ops);
+}
+
+// MySet iterators dereference to a copy of the key; the pair behind them
+// is read directly instead.
+int keyOf(mycontainers::MySet<int>::iterator it) { return it->first; }
+int keyOf(mycontainers::skiplist_set<int>::iterator it) { return *it; }
+
+// Inserts size random keys, then erases and reinserts size keys in turns
+// and finally scans the elements; returns ns per operation of each phase.
+template <class Set>
+void run(Set &set, int size, double *results) {
+  std::uint32_t state = 2463534242u;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < size; ++i) set.insert(int(nextRandom(state) >> 1));
+  results[0] = elapsedNs(start, size);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < size; ++i) set.insert(i);
+  results[1] = elapsedNs(start, size);
+
+  start = std::chrono::steady_clock::now();
+  long hits = 0;
+  for (int i = 0; i < size; ++i) {
+    auto it = set.find(int(nextRandom(state) % size));
+    if (it != set.end()) {
+      set.erase(it);
+      ++hits;
+    }
+    set.insert(int(nextRandom(state) >> 1));
+  }
+  results[2] = elapsedNs(start, 2L * size);
+
+  start = std::chrono::steady_clock::now();
+  long total = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) total += keyOf(it);
+  results[3] = elapsedNs(start, long(set.size()));
+  sink += total + hits;
+}
+
+void print(const char *name, int size, const double *results) {
+  std::printf("%10d %-18s %10.1f %10.1f %10.1f %10.2f\n", size, name,
+              results[0], results[1], results[2], results[3]);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int maxSize = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+
+  std::printf("skiplist_set vs MySet, ns per operation\n");
+  std::printf("%10s %-18s %10s %10s %10s %10s\n", "size", "container",
+              "random", "ascending", "churn", "scan");
+  for (int size = 1 << 12; size <= maxSize; size <<= 4) {
+    double results[4];
+    {
+      mycontainers::MySet<int> set;
+      run(set, size, results);
+      print("MySet", size, results);
+    }
+    for (double probability : {0.25, 0.5}) {
+      mycontainers::skiplist_set<int> set(probability);
+      run(set, size, results);
+      print(probability == 0.25 ? "skiplist p=1/4" : "skiplist p=1/2", size,
+            results);
+    }
+  }
+  return 0;
+}
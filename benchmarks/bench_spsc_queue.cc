@@ -0,0 +1,142 @@
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "../my_queue.h"
+#include "../my_spsc_queue.h"
+
+namespace {
+
+const int kBatch = 32;
+
+// The current hand-off between pipeline stages: MyQueue under a mutex.
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  bool push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+  size_t push_n(const int *first, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; n < count && queue_.size() < capacity_; ++n) queue_.push(first[n]);
+    return n;
+  }
+  size_t pop_n(int *out, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; n < count && !queue_.empty(); ++n) {
+      out[n] = queue_.front();
+      queue_.pop();
+    }
+    return n;
+  }
+
+ private:
+  std::mutex mutex_;
+  mycontainers::MyQueue<int> queue_;
+  size_t capacity_;
+};
+
+// Pins the calling thread to cpu when the machine has more than one.
+void pin(int cpu) {
+  unsigned cpus = std::thread::hardware_concurrency();
+  if (cpus < 2) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % cpus, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+// Waits for the other thread; yields so that it runs even on one CPU.
+void backoff() { std::this_thread::yield(); }
+
+// Producer pushes count values one by one (batch == 1) or batch at a time,
+// the consumer pops batch at a time; returns million values per second.
+template <class Queue>
+double throughput(long count, int batch) {
+  Queue queue(1024);
+  long sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  std::thread producer([&queue, count, batch] {
+    pin(0);
+    int values[kBatch];
+    for (long next = 0; next < count;) {
+      int n = int(count - next < batch ? count - next : batch);
+      for (int i = 0; i < n; ++i) values[i] = int(next + i);
+      size_t pushed = batch == 1 ? size_t(queue.push(values[0]))
+                                 : queue.push_n(values, size_t(n));
+      if (!pushed) backoff();
+      next += long(pushed);
+    }
+  });
+  pin(1);
+  int values[kBatch];
+  for (long received = 0; received < count;) {
+    size_t n = queue.pop_n(values, size_t(batch));
+    for (size_t i = 0; i < n; ++i) sum += values[i];
+    if (!n) backoff();
+    received += long(n);
+  }
+  producer.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (sum != count * (count - 1) / 2) std::printf("checksum mismatch\n");
+  return double(count) / elapsed.count() / 1e6;
+}
+
+// Bounces a value between two threads over a pair of queues; returns the
+// mean one-way latency in ns.
+template <class Queue>
+double latency(long rounds) {
+  Queue ping(64);
+  Queue pong(64);
+  std::thread echo([&ping, &pong, rounds] {
+    pin(1);
+    int value;
+    for (long i = 0; i < rounds; ++i) {
+      while (!ping.pop_n(&value, 1)) backoff();
+      while (!pong.push(value)) backoff();
+    }
+  });
+  pin(0);
+  auto start = std::chrono::steady_clock::now();
+  int value;
+  for (long i = 0; i < rounds; ++i) {
+    while (!ping.push(int(i))) backoff();
+    while (!pong.pop_n(&value, 1)) backoff();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  echo.join();
+  return elapsed.count() * 1e9 / double(rounds) / 2;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  long count = argc > 1 ? std::atol(argv[1]) : 10000000;
+  using SpscQueue = mycontainers::spsc_queue<int>;
+
+  std::printf("spsc_queue vs mutex-guarded MyQueue, %u CPUs\n",
+              std::thread::hardware_concurrency());
+  std::printf("%-22s %14s %14s\n", "workload", "locked", "spsc_queue");
+  std::printf("%-22s %14.1f %14.1f\n", "Mops/s, single push",
+              throughput<LockedQueue>(count, 1),
+              throughput<SpscQueue>(count, 1));
+  std::printf("%-22s %14.1f %14.1f\n", "Mops/s, batch 32",
+              throughput<LockedQueue>(count, kBatch),
+              throughput<SpscQueue>(count, kBatch));
+  std::printf("%-22s %14.1f %14.1f\n", "ns one-way latency",
+              latency<LockedQueue>(count / 50), latency<SpscQueue>(count / 50));
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <stack>
+#include <vector>
+
+#include "../my_list.h"
+#include "../my_stack.h"
+
+namespace {
+
+using ListStack = mycontainers::MyStack<int, mycontainers::list<int>>;
+using VectorStack = mycontainers::MyStack<int>;
+
+// Random graph in compressed adjacency form: the neighbours of v are
+// edges[offsets[v]] .. edges[offsets[v + 1]].
+struct Graph {
+  std::vector<int> offsets;
+  std::vector<int> edges;
+};
+
+Graph randomGraph(int vertices, int degree) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> pick(0, vertices - 1);
+  Graph graph;
+  graph.offsets.push_back(0);
+  for (int v = 0; v < vertices; ++v) {
+    for (int i = 0; i < degree; ++i) graph.edges.push_back(pick(rng));
+    graph.offsets.push_back(int(graph.edges.size()));
+  }
+  return graph;
+}
+
+// Iterative DFS from vertex 0 pushing every unvisited neighbour; returns
+// ns per push+pop and adds the visit order checksum to sum.
+template <class Stack>
+double dfs(const Graph &graph, int rounds, long &sum) {
+  int vertices = int(graph.offsets.size()) - 1;
+  std::vector<char> visited(vertices);
+  long operations = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    visited.assign(vertices, 0);
+    Stack stack;
+    stack.push(0);
+    long order = 0;
+    while (!stack.empty()) {
+      int v = stack.top();
+      stack.pop();
+      ++operations;
+      if (visited[v]) continue;
+      visited[v] = 1;
+      sum += v * ++order;
+      for (int i = graph.offsets[v]; i < graph.offsets[v + 1]; ++i) {
+        if (!visited[graph.edges[i]]) stack.push(graph.edges[i]);
+      }
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / double(operations);
+}
+
+// Pushes depth elements and pops them all, rounds times; returns ns per
+// push+pop.
+template <class Stack>
+double sawtooth(int depth, int rounds, long &sum) {
+  Stack stack;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    for (int i = 0; i < depth; ++i) stack.push(i);
+    while (!stack.empty()) {
+      sum += stack.top();
+      stack.pop();
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / (double(depth) * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int vertices = argc > 1 ? std::atoi(argv[1]) : 200000;
+  Graph graph = randomGraph(vertices, 4);
+  long sum[3] = {0, 0, 0};
+
+  std::printf("MyStack backends, ns per push+pop\n");
+  std::printf("%-18s %12s %12s %12s\n", "workload", "list", "vector",
+              "std::stack");
+  std::printf("%-18s %12.2f %12.2f %12.2f\n", "dfs",
+              dfs<ListStack>(graph, 5, sum[0]),
+              dfs<VectorStack>(graph, 5, sum[1]),
+              dfs<std::stack<int>>(graph, 5, sum[2]));
+  for (int depth : {64, 100000}) {
+    int rounds = 10000000 / depth;
+    char name[32];
+    std::snprintf(name, sizeof(name), "sawtooth %d", depth);
+    std::printf("%-18s %12.2f %12.2f %12.2f\n", name,
+                sawtooth<ListStack>(depth, rounds, sum[0]),
+                sawtooth<VectorStack>(depth, rounds, sum[1]),
+                sawtooth<std::stack<int>>(depth, rounds, sum[2]));
+  }
+  if (sum[0] != sum[1] || sum[1] != sum[2]) {
+    std::printf("checksum mismatch\n");
+    return 1;
+  }
+  return 0;
+}
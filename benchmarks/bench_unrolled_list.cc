@@ -0,0 +1,50 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../my_list.h"
+#include "../my_unrolled_list.h"
+
+namespace {
+
+std::atomic<long> sink{0};
+
+template <class List>
+double scan(const List &items, int passes) {
+  long total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; ++pass) {
+    for (auto it = items.cbegin(); it != items.cend(); ++it) total += *it;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  sink += total;
+  return elapsed.count() * 1e9 / (double(passes) * items.size());
+}
+
+template <class List>
+double run(int size, int passes) {
+  List items;
+  for (int i = 0; i < size; ++i) items.push_back(i);
+  return scan(items, passes);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int maxSize = argc > 1 ? std::atoi(argv[1]) : 1 << 22;
+  long elements = argc > 2 ? std::atol(argv[2]) : 1L << 25;
+
+  std::printf("unrolled_list vs list scan, ns per element\n");
+  std::printf("%10s %10s %14s %14s\n", "size", "list", "unrolled<16>",
+              "unrolled<64>");
+  for (int size = 1 << 10; size <= maxSize; size <<= 4) {
+    int passes = int(elements / size > 0 ? elements / size : 1);
+    double plain = run<mycontainers::list<int>>(size, passes);
+    double small = run<mycontainers::unrolled_list<int, 16>>(size, passes);
+    double large = run<mycontainers::unrolled_list<int, 64>>(size, passes);
+    std::printf("%10d %10.3f %14.3f %14.3f\n", size, plain, small, large);
+  }
+  return 0;
+}
@@ -0,0 +1,118 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../my_stack.h"
+#include "../my_work_stealing_deque.h"
+
+namespace {
+
+const int kCutoff = 6;
+
+// A worker's local queue as it is today: MyStack under a mutex, with
+// thieves taking from the same end as the owner.
+class LockedStack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+  bool steal(int &out) { return pop(out); }
+
+ private:
+  std::mutex mutex_;
+  mycontainers::MyStack<int> stack_;
+};
+
+long fibSerial(int n) {
+  return n < 2 ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+// Fork-join fib(n): a task n >= kCutoff forks n - 1 and n - 2 into the
+// worker's own queue, smaller ones are computed serially. Idle workers
+// steal from the others. Returns the result and stores the time in ms.
+template <class Queue>
+long fib(int n, int workers, double &ms) {
+  std::vector<std::unique_ptr<Queue>> queues;
+  for (int w = 0; w < workers; ++w) queues.emplace_back(new Queue());
+  std::atomic<long> pending{1};
+  std::atomic<long> result{0};
+  queues[0]->push(n);
+
+  auto work = [&](int self) {
+    Queue &own = *queues[self];
+    std::uint32_t seed = 2463534242u + self;
+    long local = 0;
+    int task;
+    while (pending.load(std::memory_order_acquire)) {
+      bool found = own.pop(task);
+      for (int tries = 0; !found && tries < workers; ++tries) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        int victim = int(seed % unsigned(workers));
+        if (victim != self) found = queues[victim]->steal(task);
+      }
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (task < kCutoff) {
+        local += fibSerial(task);
+        pending.fetch_sub(1, std::memory_order_acq_rel);
+      } else {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        own.push(task - 2);
+        own.push(task - 1);
+      }
+    }
+    result += local;
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int w = 1; w < workers; ++w) threads.emplace_back(work, w);
+  work(0);
+  for (auto &thread : threads) thread.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  ms = elapsed.count() * 1e3;
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 32;
+  long expected = fibSerial(n);
+
+  std::printf("fork-join fib(%d), cutoff %d, ms, %u CPUs\n", n, kCutoff,
+              std::thread::hardware_concurrency());
+  std::printf("%-8s %14s %14s\n", "workers", "locked stack", "chase-lev");
+  for (int workers : {1, 2, 4, 8}) {
+    double lockedMs = 0;
+    double dequeMs = 0;
+    long locked = fib<LockedStack>(n, workers, lockedMs);
+    long deque =
+        fib<mycontainers::work_stealing_deque<int>>(n, workers, dequeMs);
+    if (locked != expected || deque != expected) {
+      std::printf("wrong result\n");
+      return 1;
+    }
+    std::printf("%-8d %14.1f %14.1f\n", workers, lockedMs, dequeMs);
+  }
+  return 0;
+}
@@ -1,8 +1,20 @@
 #ifndef MY_CONTAINERS_MY_ARRAY_H
 #define MY_CONTAINERS_MY_ARRAY_H
 
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 namespace mycontainers {
 
+// Fixed-size array holding its elements inline, like std::array: an
+// aggregate with the elements as its only member, so it is initialized
+// with braces (missing elements are value-initialized), takes exactly
+// sizeof(T) * N bytes and is trivially copyable when T is. A vector of
+// arrays is then one contiguous block of elements. Everything is constexpr,
+// so a table can be computed by a constexpr function into a constexpr
+// array and end up in read-only data instead of being built at startup.
 template <class T, std::size_t N>
 class array {
  public:
@@ -17,84 +29,87 @@ class array {
   using const_iterator = const T *;
   using size_type = size_t;
 
-  array();
-  array(std::initializer_list<value_type> const &items);
-  array(const array &a);
-  array(array &&a) noexcept;
-  ~array();
-
-  array &operator=(const array &a);
-  array &operator=(array &&a) noexcept;
-
-  reference at(size_type pos);
-  reference operator[](size_type pos) const;
-  const_reference front() const;
-  const_reference back() const;
-  iterator data();
-
-  iterator begin() const;
-  iterator end() const;
-
-  bool empty() const noexcept;
-  size_type size() noexcept;
-  size_type max_size() const;
-
-  void swap(array &other);
-  void fill(const_reference value);
-
- private:
-  value_type *data_ = nullptr;
-  const size_type size_ = N;
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+  constexpr reference front();
+  constexpr const_reference front() const;
+  constexpr reference back();
+  constexpr const_reference back() const;
+  constexpr iterator data() noexcept;
+  constexpr const_iterator data() const noexcept;
+
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + N; }
+  constexpr const_iterator end() const noexcept { return data() + N; }
+  constexpr const_iterator cbegin() const noexcept { return begin(); }
+  constexpr const_iterator cend() const noexcept { return end(); }
+
+  constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
+
+  constexpr void swap(array &other);
+  constexpr void fill(const_reference value);
+
+  // Public only so that the class stays an aggregate; use data(). An
+  // empty struct stands in for the elements when N is 0.
+  struct Empty {};
+  std::conditional_t<N == 0, Empty, T[N ? N : 1]> data_;
 };
 
 template <class T, std::size_t N>
 class array<T, N>::ArrayConstIterator {
  public:
-  ArrayConstIterator(){};
-  ArrayConstIterator(T *);
+  constexpr ArrayConstIterator() {}
+  constexpr ArrayConstIterator(T *);
 
-  T &operator*();
-  typename array<T, N>::ArrayConstIterator operator++();
-  typename array<T, N>::ArrayConstIterator operator--();
-  bool operator==(const ArrayConstIterator it);
-  bool operator!=(const ArrayConstIterator it);
-  size_type operator-(const ArrayConstIterator it);
+  constexpr T &operator*();
+  constexpr typename array<T, N>::ArrayConstIterator operator++();
+  constexpr typename array<T, N>::ArrayConstIterator operator--();
+  constexpr bool operator==(const ArrayConstIterator it);
+  constexpr bool operator!=(const ArrayConstIterator it);
+  constexpr size_type operator-(const ArrayConstIterator it);
 
  private:
-  const T *ptr_;
+  const T *ptr_ = nullptr;
 };
 
 // class const_iterator foo begin
 
 template <class T, std::size_t N>
-array<T, N>::ArrayConstIterator::ArrayConstIterator(T *p) : ptr_(p) {}
+constexpr array<T, N>::ArrayConstIterator::ArrayConstIterator(T *p) : ptr_(p) {}
 
 template <class T, std::size_t N>
-T &array<T, N>::ArrayConstIterator::operator*() {
+constexpr T &array<T, N>::ArrayConstIterator::operator*() {
   return *ptr_;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::ArrayConstIterator
+constexpr typename array<T, N>::ArrayConstIterator
 array<T, N>::ArrayConstIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::ArrayConstIterator
+constexpr typename array<T, N>::ArrayConstIterator
 array<T, N>::ArrayConstIterator::operator--() {
   --ptr_;
   return *this;
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::ArrayConstIterator::operator==(const ArrayConstIterator it) {
+constexpr bool array<T, N>::ArrayConstIterator::operator==(
+    const ArrayConstIterator it) {
   return ptr_ == it.ptr_ ? 1 : 0;
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::ArrayConstIterator::operator!=(const ArrayConstIterator it) {
+constexpr bool array<T, N>::ArrayConstIterator::operator!=(
+    const ArrayConstIterator it) {
   return ptr_ == it.ptr_ ? 0 : 1;
 }
 
@@ -103,181 +118,174 @@ bool array<T, N>::ArrayConstIterator::operator!=(const ArrayConstIterator it) {
 template <class T, std::size_t N>
 class array<T, N>::ArrayIterator {
  public:
-  ArrayIterator(){};
-  ArrayIterator(T *);
+  constexpr ArrayIterator() {}
+  constexpr ArrayIterator(T *);
 
-  T &operator*();
-  typename array<T, N>::ArrayIterator operator++();
-  typename array<T, N>::ArrayIterator operator--();
-  bool operator==(const ArrayIterator it);
-  bool operator!=(const ArrayIterator it);
+  constexpr T &operator*();
+  constexpr typename array<T, N>::ArrayIterator operator++();
+  constexpr typename array<T, N>::ArrayIterator operator--();
+  constexpr bool operator==(const ArrayIterator it);
+  constexpr bool operator!=(const ArrayIterator it);
 
  private:
-  T *ptr_;
+  T *ptr_ = nullptr;
 };
 
 // class iterator foo begin
 
 template <class T, std::size_t N>
-array<T, N>::ArrayIterator::ArrayIterator(T *p) : ptr_(p) {}
+constexpr array<T, N>::ArrayIterator::ArrayIterator(T *p) : ptr_(p) {}
 
 template <class T, std::size_t N>
-T &array<T, N>::ArrayIterator::operator*() {
+constexpr T &array<T, N>::ArrayIterator::operator*() {
   return *ptr_;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::ArrayIterator array<T, N>::ArrayIterator::operator++() {
+constexpr typename array<T, N>::ArrayIterator
+array<T, N>::ArrayIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::ArrayIterator array<T, N>::ArrayIterator::operator--() {
+constexpr typename array<T, N>::ArrayIterator
+array<T, N>::ArrayIterator::operator--() {
   --ptr_;
   return *this;
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::ArrayIterator::operator==(const ArrayIterator it) {
+constexpr bool array<T, N>::ArrayIterator::operator==(
+    const ArrayIterator it) {
   return ptr_ == it.ptr_ ? 1 : 0;
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::ArrayIterator::operator!=(const ArrayIterator it) {
+constexpr bool array<T, N>::ArrayIterator::operator!=(
+    const ArrayIterator it) {
   return ptr_ == it.ptr_ ? 0 : 1;
 }
 
 // class iterator foo end
 
 template <class T, std::size_t N>
-void array<T, N>::fill(const_reference value) {
-  for (size_t i = 0; i < size_; ++i) {
-    data_[i] = value;
+constexpr void array<T, N>::fill(const_reference value) {
+  for (size_t i = 0; i < N; ++i) {
+    data()[i] = value;
   }
 }
 
+// std::swap is constexpr only since C++20.
 template <class T, std::size_t N>
-void array<T, N>::swap(array &other) {
-  if (size_ == other.size_) {
-    array<T, N> tmp(*this);
-    for (size_t i = 0; i < size_; ++i) {
-      data_[i] = other.data_[i];
-      other.data_[i] = tmp.data_[i];
-    }
+constexpr void array<T, N>::swap(array &other) {
+  for (size_t i = 0; i < N; ++i) {
+    T tmp(std::move(data()[i]));
+    data()[i] = std::move(other.data()[i]);
+    other.data()[i] = std::move(tmp);
   }
 }
 
 template <class T, std::size_t N>
-size_t array<T, N>::max_size() const {
-  return size_;
-}
-
-template <class T, std::size_t N>
-size_t array<T, N>::size() noexcept {
-  return size_;
+constexpr T *array<T, N>::data() noexcept {
+  if constexpr (N == 0) {
+    return nullptr;
+  } else {
+    return data_;
+  }
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::empty() const noexcept {
-  return size_ == 0 ? true : false;
+constexpr const T *array<T, N>::data() const noexcept {
+  if constexpr (N == 0) {
+    return nullptr;
+  } else {
+    return data_;
+  }
 }
 
 template <class T, std::size_t N>
-T *array<T, N>::begin() const {
-  return data_;
+constexpr T &array<T, N>::operator[](size_type pos) {
+  return at(pos);
 }
 
 template <class T, std::size_t N>
-T *array<T, N>::end() const {
-  return data_ + size_;
+constexpr const T &array<T, N>::operator[](size_type pos) const {
+  return at(pos);
 }
 
 template <class T, std::size_t N>
-T &array<T, N>::operator[](size_type pos) const {
-  if (pos >= size_) {
+constexpr T &array<T, N>::at(size_type pos) {
+  if (pos >= N) {
     throw std::out_of_range("mycontainers::array::range_check");
   };
-  return data_[pos];
+  return data()[pos];
 }
 
 template <class T, std::size_t N>
-T &array<T, N>::at(size_type pos) {
-  if (pos >= size_) {
+constexpr const T &array<T, N>::at(size_type pos) const {
+  if (pos >= N) {
     throw std::out_of_range("mycontainers::array::range_check");
   };
-  return data_[pos];
+  return data()[pos];
 }
 
 template <class T, std::size_t N>
-T *array<T, N>::data() {
-  return data_;
+constexpr T &array<T, N>::back() {
+  return at(N - 1);
 }
 
 template <class T, std::size_t N>
-const T &array<T, N>::back() const {
-  if (size_ == 0) {
-    throw std::out_of_range("mycontainers::array::range_check");
-  };
-  return data_[size_ - 1];
+constexpr const T &array<T, N>::back() const {
+  return at(N - 1);
 }
 
 template <class T, std::size_t N>
-const T &array<T, N>::front() const {
-  if (size_ == 0) {
-    throw std::out_of_range("mycontainers::array::range_check");
-  };
-  return data_[0];
+constexpr T &array<T, N>::front() {
+  return at(0);
 }
 
 template <class T, std::size_t N>
-array<T, N> &array<T, N>::operator=(array &&a) noexcept {
-  if (this == &a) return *this;
-  std::swap(data_, a.data_);
-  return *this;
+constexpr const T &array<T, N>::front() const {
+  return at(0);
 }
 
+// Lexicographic comparisons, as for std::array.
 template <class T, std::size_t N>
-array<T, N> &array<T, N>::operator=(const array &a) {
-  if (this == &a) return *this;
-  for (size_t i = 0; i < size_; ++i) {
-    data_[i] = a.data_[i];
+constexpr bool operator==(const array<T, N> &lhs, const array<T, N> &rhs) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!(lhs.data()[i] == rhs.data()[i])) return false;
   }
-  return *this;
+  return true;
 }
 
 template <class T, std::size_t N>
-array<T, N>::array() : size_(N) {
-  data_ = new value_type[size_]();
+constexpr bool operator<(const array<T, N> &lhs, const array<T, N> &rhs) {
+  for (size_t i = 0; i < N; ++i) {
+    if (lhs.data()[i] < rhs.data()[i]) return true;
+    if (rhs.data()[i] < lhs.data()[i]) return false;
+  }
+  return false;
 }
 
 template <class T, std::size_t N>
-array<T, N>::array(std::initializer_list<value_type> const &items) {
-  data_ = new value_type[N]();
-  auto iter = items.begin();
-  for (size_type i = 0; i < items.size(); ++i) {
-    data_[i] = *(iter + i);
-  }
+constexpr bool operator!=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(lhs == rhs);
 }
 
 template <class T, std::size_t N>
-array<T, N>::array(const array &a) : size_(a.size_) {
-  data_ = new value_type[N]();
-  for (size_t i = 0; i < size_; ++i) {
-    data_[i] = a.data_[i];
-  }
+constexpr bool operator>(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return rhs < lhs;
 }
 
 template <class T, std::size_t N>
-array<T, N>::array(array &&a) noexcept {
-  std::swap(data_, a.data_);
+constexpr bool operator<=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(rhs < lhs);
 }
 
 template <class T, std::size_t N>
-array<T, N>::~array() {
-  if (data_) {
-    delete[] data_;
-  }
+constexpr bool operator>=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(lhs < rhs);
 }
 
 }  // namespace mycontainers
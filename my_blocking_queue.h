@@ -0,0 +1,175 @@
+#ifndef MY_CONTAINERS_MY_BLOCKING_QUEUE_H
+#define MY_CONTAINERS_MY_BLOCKING_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "my_ring_buffer.h"
+
+namespace mycontainers {
+
+// Queue for pools of producer and consumer threads under one mutex. The
+// batch operations move up to a whole batch per lock acquisition, and a
+// thread is woken only when someone is waiting: a consumer that leaves
+// elements behind wakes the next waiting consumer itself, so a push of
+// many elements does not wake one consumer per element. With a capacity,
+// producers wait for room (backpressure). close() makes pushes fail and
+// wakes every waiter; consumers still drain what is left.
+template <class T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // A capacity of 0 leaves the queue unbounded.
+  explicit blocking_queue(size_type capacity = 0);
+  blocking_queue(const blocking_queue &q) = delete;
+  blocking_queue(blocking_queue &&q) = delete;
+  ~blocking_queue() = default;
+
+  blocking_queue &operator=(const blocking_queue &q) = delete;
+  blocking_queue &operator=(blocking_queue &&q) = delete;
+
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const noexcept { return capacity_; }
+  bool closed() const;
+
+  // Waits for room; returns false if the queue is closed.
+  bool push(const_reference value) { return push_batch(&value, 1) == 1; }
+  // Pushes count elements read from first, waiting for room as needed;
+  // returns fewer than count only if the queue gets closed.
+  template <class InputIt>
+  size_type push_batch(InputIt first, size_type count);
+  // Waits for an element and moves it to out; returns false once the
+  // queue is closed and drained.
+  bool pop(reference out) { return pop_batch(&out, 1) == 1; }
+  // Waits for at least one element (at most timeout in the second form)
+  // and moves up to max elements to out; returns their number, 0 on
+  // timeout or once the queue is closed and drained.
+  template <class OutputIt>
+  size_type pop_batch(OutputIt out, size_type max);
+  template <class OutputIt, class Rep, class Period>
+  size_type pop_batch(OutputIt out, size_type max,
+                      const std::chrono::duration<Rep, Period> &timeout);
+  void close();
+
+ private:
+  using Lock = std::unique_lock<std::mutex>;
+
+  bool full() const { return capacity_ && c_.size() >= capacity_; }
+  template <class OutputIt>
+  size_type drain(OutputIt out, size_type max);
+
+  mutable std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  mycontainers::ring_buffer<value_type> c_;
+  size_type capacity_;
+  size_type consumersWaiting_ = 0;
+  size_type producersWaiting_ = 0;
+  bool closed_ = false;
+};  // class blocking_queue
+
+template <class T>
+blocking_queue<T>::blocking_queue(size_type capacity) : capacity_(capacity) {
+  if (capacity_) c_.reserve(capacity_);
+}
+
+template <class T>
+bool blocking_queue<T>::empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return c_.empty();
+}
+
+template <class T>
+size_t blocking_queue<T>::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return c_.size();
+}
+
+template <class T>
+bool blocking_queue<T>::closed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+template <class T>
+template <class InputIt>
+size_t blocking_queue<T>::push_batch(InputIt first, size_type count) {
+  Lock lock(mutex_);
+  size_type pushed = 0;
+  while (pushed < count && !closed_) {
+    if (full()) {
+      ++producersWaiting_;
+      notFull_.wait(lock, [this] { return closed_ || !full(); });
+      --producersWaiting_;
+      continue;
+    }
+    for (; pushed < count && !full(); ++pushed, ++first) c_.push_back(*first);
+    if (consumersWaiting_) notEmpty_.notify_one();
+  }
+  if (!full() && producersWaiting_) notFull_.notify_one();
+  return pushed;
+}
+
+template <class T>
+template <class OutputIt>
+size_t blocking_queue<T>::pop_batch(OutputIt out, size_type max) {
+  Lock lock(mutex_);
+  if (c_.empty() && !closed_ && max) {
+    ++consumersWaiting_;
+    notEmpty_.wait(lock, [this] { return closed_ || !c_.empty(); });
+    --consumersWaiting_;
+  }
+  return drain(out, max);
+}
+
+template <class T>
+template <class OutputIt, class Rep, class Period>
+size_t blocking_queue<T>::pop_batch(
+    OutputIt out, size_type max,
+    const std::chrono::duration<Rep, Period> &timeout) {
+  Lock lock(mutex_);
+  if (c_.empty() && !closed_ && max) {
+    ++consumersWaiting_;
+    notEmpty_.wait_for(lock, timeout,
+                       [this] { return closed_ || !c_.empty(); });
+    --consumersWaiting_;
+  }
+  return drain(out, max);
+}
+
+template <class T>
+void blocking_queue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  notEmpty_.notify_all();
+  notFull_.notify_all();
+}
+
+// Called with the mutex held. Passes the wake-up on to the next waiting
+// consumer if elements are left and to a waiting producer if room was made.
+template <class T>
+template <class OutputIt>
+size_t blocking_queue<T>::drain(OutputIt out, size_type max) {
+  size_type popped = 0;
+  for (; popped < max && !c_.empty(); ++popped, ++out) {
+    *out = std::move(c_.front());
+    c_.pop_front();
+  }
+  if (!c_.empty() && consumersWaiting_) notEmpty_.notify_one();
+  if (popped && producersWaiting_) notFull_.notify_one();
+  return popped;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_BLOCKING_QUEUE_H
@@ -0,0 +1,517 @@
+#ifndef MY_CONTAINERS_MY_CONCURRENT_MAP_H
+#define MY_CONTAINERS_MY_CONCURRENT_MAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "my_vector.h"
+
+namespace mycontainers {
+
+// Ordered map for concurrent readers and writers. It is a lazy skip list:
+// lookups and range scans take no locks, insert and erase lock only the
+// predecessors of the node they change. Erased nodes are reclaimed once no
+// thread can still be reading them (epoch-based, see EpochGuard).
+template <class Key, class T>
+class concurrent_map {
+  class Node;
+  class SpinLock;
+  class EpochGuard;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  concurrent_map();
+  concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &m) = delete;
+  concurrent_map(concurrent_map &&m) = delete;
+  ~concurrent_map();
+
+  concurrent_map &operator=(const concurrent_map &m) = delete;
+  concurrent_map &operator=(concurrent_map &&m) = delete;
+
+  std::optional<mapped_type> find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  std::optional<value_type> lower_bound(const key_type &key) const;
+
+  template <class Function>
+  void for_each(Function f) const;
+  template <class Function>
+  void for_each(const key_type &first, const key_type &last, Function f) const;
+
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  bool insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+  bool insert(const key_type &key, const mapped_type &obj);
+  bool erase(const key_type &key);
+  void clear();
+
+ private:
+  static constexpr int kMaxHeight = 32;
+  static constexpr size_type kStripes = 64;
+  static constexpr size_type kReclaimBatch = 128;
+
+  struct alignas(64) Stripe {
+    std::atomic<size_type> readers[2] = {};
+  };
+
+  int findNode(const key_type &key, Node **preds, Node **succs) const;
+  Node *firstNotLess(const key_type &key) const;
+  Node *unlinkNode(const key_type &key);
+  void retire(Node *node);
+  void synchronize();
+
+  static void unlockPreds(Node **preds, int highestLocked);
+  static int randomHeight();
+  static size_type threadStripe();
+  static int &guardDepth();
+
+  Node *head_;
+  std::atomic<size_type> size_{0};
+  std::atomic<size_type> epoch_{0};
+  mutable Stripe stripes_[kStripes];
+  std::mutex retireMutex_;
+  std::mutex syncMutex_;
+  mycontainers::vector<Node *> retired_;
+};
+
+template <class Key, class T>
+class concurrent_map<Key, T>::SpinLock {
+ public:
+  void lock() noexcept {
+    while (flag_.exchange(true, std::memory_order_acquire)) {
+      while (flag_.load(std::memory_order_relaxed)) std::this_thread::yield();
+    }
+  }
+  void unlock() noexcept { flag_.store(false, std::memory_order_release); }
+
+ private:
+  std::atomic<bool> flag_{false};
+};  // class SpinLock
+
+// The tower of next links is allocated inline, right after the node.
+template <class Key, class T>
+class alignas(std::atomic<void *>) concurrent_map<Key, T>::Node {
+ public:
+  static Node *create(int height);
+  static Node *create(const key_type &key, const mapped_type &obj,
+                      int height);
+  static void destroy(Node *node);
+
+  value_type &getValue() {
+    return *std::launder(reinterpret_cast<value_type *>(storage_));
+  }
+  const key_type &getKey() { return getValue().first; }
+  int getHeight() const { return height_; }
+  std::atomic<Node *> &next(int level) {
+    return reinterpret_cast<std::atomic<Node *> *>(this + 1)[level];
+  }
+  bool isLive() {
+    return linked_.load(std::memory_order_acquire) &&
+           !marked_.load(std::memory_order_acquire);
+  }
+
+  SpinLock lock_;
+  std::atomic<bool> marked_{false};
+  std::atomic<bool> linked_{false};
+
+ private:
+  explicit Node(int height) : height_(height) {}
+
+  int height_;
+  bool hasValue_ = false;
+  alignas(value_type) unsigned char storage_[sizeof(value_type)];
+};  // class Node
+
+template <class Key, class T>
+typename concurrent_map<Key, T>::Node *concurrent_map<Key, T>::Node::create(
+    int height) {
+  void *raw =
+      ::operator new(sizeof(Node) + height * sizeof(std::atomic<Node *>));
+  Node *node = new (raw) Node(height);
+  for (int level = 0; level < height; ++level) {
+    new (&node->next(level)) std::atomic<Node *>(nullptr);
+  }
+  return node;
+}
+
+template <class Key, class T>
+typename concurrent_map<Key, T>::Node *concurrent_map<Key, T>::Node::create(
+    const key_type &key, const mapped_type &obj, int height) {
+  Node *node = create(height);
+  try {
+    new (node->storage_) value_type(key, obj);
+  } catch (...) {
+    destroy(node);
+    throw;
+  }
+  node->hasValue_ = true;
+  return node;
+}
+
+template <class Key, class T>
+void concurrent_map<Key, T>::Node::destroy(Node *node) {
+  if (node->hasValue_) node->getValue().~value_type();
+  node->~Node();
+  ::operator delete(node);
+}
+
+// Marks the calling thread as reading the list. Writers that retire nodes
+// advance the epoch and wait until every reader of the previous epoch has
+// left before freeing them.
+template <class Key, class T>
+class concurrent_map<Key, T>::EpochGuard {
+ public:
+  explicit EpochGuard(const concurrent_map *map);
+  ~EpochGuard();
+
+  EpochGuard(const EpochGuard &) = delete;
+  EpochGuard &operator=(const EpochGuard &) = delete;
+
+ private:
+  std::atomic<size_type> *readers_;
+};  // class EpochGuard
+
+template <class Key, class T>
+concurrent_map<Key, T>::EpochGuard::EpochGuard(const concurrent_map *map) {
+  Stripe &stripe = map->stripes_[threadStripe()];
+  for (;;) {
+    size_type epoch = map->epoch_.load();
+    readers_ = &stripe.readers[epoch & 1];
+    readers_->fetch_add(1);
+    if (map->epoch_.load() == epoch) break;
+    readers_->fetch_sub(1);
+  }
+  ++guardDepth();
+}
+
+template <class Key, class T>
+concurrent_map<Key, T>::EpochGuard::~EpochGuard() {
+  --guardDepth();
+  readers_->fetch_sub(1);
+}
+
+template <class Key, class T>
+concurrent_map<Key, T>::concurrent_map() : head_(Node::create(kMaxHeight)) {
+  head_->linked_.store(true);
+}
+
+template <class Key, class T>
+concurrent_map<Key, T>::concurrent_map(
+    std::initializer_list<value_type> const &items)
+    : concurrent_map() {
+  for (auto &item : items) {
+    insert(item.first, item.second);
+  }
+}
+
+template <class Key, class T>
+concurrent_map<Key, T>::~concurrent_map() {
+  Node *node = head_;
+  while (node) {
+    Node *next = node->next(0).load(std::memory_order_relaxed);
+    Node::destroy(node);
+    node = next;
+  }
+  for (size_type i = 0; i < retired_.size(); ++i) {
+    Node::destroy(retired_[i]);
+  }
+}
+
+template <class Key, class T>
+std::optional<T> concurrent_map<Key, T>::find(const key_type &key) const {
+  EpochGuard guard(this);
+  Node *node = firstNotLess(key);
+  if (node && !(key < node->getKey())) return node->getValue().second;
+  return std::nullopt;
+}
+
+template <class Key, class T>
+bool concurrent_map<Key, T>::contains(const key_type &key) const {
+  EpochGuard guard(this);
+  Node *node = firstNotLess(key);
+  return node && !(key < node->getKey());
+}
+
+template <class Key, class T>
+std::optional<typename concurrent_map<Key, T>::value_type>
+concurrent_map<Key, T>::lower_bound(const key_type &key) const {
+  EpochGuard guard(this);
+  Node *node = firstNotLess(key);
+  if (node) return node->getValue();
+  return std::nullopt;
+}
+
+template <class Key, class T>
+template <class Function>
+void concurrent_map<Key, T>::for_each(Function f) const {
+  EpochGuard guard(this);
+  Node *node = head_->next(0).load(std::memory_order_acquire);
+  for (; node; node = node->next(0).load(std::memory_order_acquire)) {
+    if (node->isLive()) f(static_cast<const_reference>(node->getValue()));
+  }
+}
+
+template <class Key, class T>
+template <class Function>
+void concurrent_map<Key, T>::for_each(const key_type &first,
+                                      const key_type &last, Function f) const {
+  EpochGuard guard(this);
+  Node *node = firstNotLess(first);
+  for (; node && node->getKey() < last;
+       node = node->next(0).load(std::memory_order_acquire)) {
+    if (node->isLive()) f(static_cast<const_reference>(node->getValue()));
+  }
+}
+
+template <class Key, class T>
+bool concurrent_map<Key, T>::insert(const key_type &key,
+                                    const mapped_type &obj) {
+  Node *preds[kMaxHeight];
+  Node *succs[kMaxHeight];
+  Node *node = nullptr;
+  int height = randomHeight();
+
+  EpochGuard guard(this);
+  for (;;) {
+    int found = findNode(key, preds, succs);
+    if (found != -1) {
+      Node *existing = succs[found];
+      if (!existing->marked_.load()) {
+        while (!existing->linked_.load()) std::this_thread::yield();
+        if (node) Node::destroy(node);
+        return false;
+      }
+      std::this_thread::yield();
+      continue;
+    }
+
+    if (!node) node = Node::create(key, obj, height);
+
+    int highestLocked = -1;
+    bool valid = true;
+    for (int level = 0; valid && level < height; ++level) {
+      Node *pred = preds[level];
+      Node *succ = succs[level];
+      if (level == 0 || pred != preds[level - 1]) pred->lock_.lock();
+      highestLocked = level;
+      valid = !pred->marked_.load() && (!succ || !succ->marked_.load()) &&
+              pred->next(level).load() == succ;
+    }
+    if (!valid) {
+      unlockPreds(preds, highestLocked);
+      continue;
+    }
+
+    for (int level = 0; level < height; ++level) {
+      node->next(level).store(succs[level], std::memory_order_relaxed);
+    }
+    for (int level = 0; level < height; ++level) {
+      preds[level]->next(level).store(node, std::memory_order_release);
+    }
+    node->linked_.store(true);
+    unlockPreds(preds, highestLocked);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+}
+
+template <class Key, class T>
+bool concurrent_map<Key, T>::erase(const key_type &key) {
+  Node *victim = nullptr;
+  {
+    EpochGuard guard(this);
+    victim = unlinkNode(key);
+  }
+  if (!victim) return false;
+  retire(victim);
+  return true;
+}
+
+template <class Key, class T>
+void concurrent_map<Key, T>::clear() {
+  for (;;) {
+    std::optional<key_type> key;
+    {
+      EpochGuard guard(this);
+      Node *node = head_->next(0).load(std::memory_order_acquire);
+      if (!node) return;
+      key.emplace(node->getKey());
+    }
+    erase(*key);
+  }
+}
+
+template <class Key, class T>
+int concurrent_map<Key, T>::findNode(const key_type &key, Node **preds,
+                                     Node **succs) const {
+  int found = -1;
+  Node *pred = head_;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    Node *curr = pred->next(level).load(std::memory_order_acquire);
+    while (curr && curr->getKey() < key) {
+      pred = curr;
+      curr = pred->next(level).load(std::memory_order_acquire);
+    }
+    if (found == -1 && curr && !(key < curr->getKey())) found = level;
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  return found;
+}
+
+template <class Key, class T>
+typename concurrent_map<Key, T>::Node *concurrent_map<Key, T>::firstNotLess(
+    const key_type &key) const {
+  Node *pred = head_;
+  Node *curr = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; --level) {
+    curr = pred->next(level).load(std::memory_order_acquire);
+    while (curr && curr->getKey() < key) {
+      pred = curr;
+      curr = pred->next(level).load(std::memory_order_acquire);
+    }
+  }
+  while (curr && !curr->isLive()) {
+    curr = curr->next(0).load(std::memory_order_acquire);
+  }
+  return curr;
+}
+
+template <class Key, class T>
+typename concurrent_map<Key, T>::Node *concurrent_map<Key, T>::unlinkNode(
+    const key_type &key) {
+  Node *preds[kMaxHeight];
+  Node *succs[kMaxHeight];
+  Node *victim = nullptr;
+  bool isMarked = false;
+  int height = 0;
+
+  for (;;) {
+    int found = findNode(key, preds, succs);
+    if (!isMarked) {
+      if (found == -1) return nullptr;
+      victim = succs[found];
+      if (!victim->linked_.load() || victim->getHeight() - 1 != found ||
+          victim->marked_.load()) {
+        return nullptr;
+      }
+      height = victim->getHeight();
+      victim->lock_.lock();
+      if (victim->marked_.load()) {
+        victim->lock_.unlock();
+        return nullptr;
+      }
+      victim->marked_.store(true);
+      isMarked = true;
+    }
+
+    int highestLocked = -1;
+    bool valid = true;
+    for (int level = 0; valid && level < height; ++level) {
+      Node *pred = preds[level];
+      if (level == 0 || pred != preds[level - 1]) pred->lock_.lock();
+      highestLocked = level;
+      valid = !pred->marked_.load() && pred->next(level).load() == victim;
+    }
+    if (!valid) {
+      unlockPreds(preds, highestLocked);
+      continue;
+    }
+
+    for (int level = height - 1; level >= 0; --level) {
+      preds[level]->next(level).store(victim->next(level).load(),
+                                      std::memory_order_release);
+    }
+    victim->lock_.unlock();
+    unlockPreds(preds, highestLocked);
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    return victim;
+  }
+}
+
+template <class Key, class T>
+void concurrent_map<Key, T>::retire(Node *node) {
+  mycontainers::vector<Node *> batch;
+  {
+    std::lock_guard<std::mutex> lock(retireMutex_);
+    retired_.push_back(node);
+    if (retired_.size() < kReclaimBatch || guardDepth() > 0) return;
+    batch.swap(retired_);
+  }
+  synchronize();
+  for (size_type i = 0; i < batch.size(); ++i) {
+    Node::destroy(batch[i]);
+  }
+}
+
+template <class Key, class T>
+void concurrent_map<Key, T>::synchronize() {
+  std::lock_guard<std::mutex> lock(syncMutex_);
+  size_type parity = epoch_.fetch_add(1) & 1;
+  for (size_type i = 0; i < kStripes; ++i) {
+    while (stripes_[i].readers[parity].load() != 0) std::this_thread::yield();
+  }
+}
+
+template <class Key, class T>
+void concurrent_map<Key, T>::unlockPreds(Node **preds, int highestLocked) {
+  for (int level = 0; level <= highestLocked; ++level) {
+    if (level == 0 || preds[level] != preds[level - 1]) {
+      preds[level]->lock_.unlock();
+    }
+  }
+}
+
+template <class Key, class T>
+int concurrent_map<Key, T>::randomHeight() {
+  thread_local std::uint64_t state =
+      reinterpret_cast<std::uintptr_t>(&state) * 0x9E3779B97F4A7C15ull | 1;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  int height = 1;
+  for (std::uint64_t bits = state; height < kMaxHeight && (bits & 1);
+       bits >>= 1) {
+    ++height;
+  }
+  return height;
+}
+
+template <class Key, class T>
+typename concurrent_map<Key, T>::size_type
+concurrent_map<Key, T>::threadStripe() {
+  static std::atomic<size_type> next{0};
+  thread_local size_type stripe = kStripes;
+  if (stripe == kStripes) {
+    stripe = next.fetch_add(1, std::memory_order_relaxed) % kStripes;
+  }
+  return stripe;
+}
+
+template <class Key, class T>
+int &concurrent_map<Key, T>::guardDepth() {
+  thread_local int depth = 0;
+  return depth;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_CONCURRENT_MAP_H
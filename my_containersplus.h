@@ -2,6 +2,20 @@
 #define MY_CONTAINERS_MY_CONTAINERSPLUS_H
 
 #include "my_array.h"
+#include "my_blocking_queue.h"
+#include "my_concurrent_map.h"
+#include "my_counted_multiset.h"
+#include "my_deque.h"
+#include "my_intrusive_list.h"
+#include "my_mpmc_queue.h"
 #include "my_multiset.h"
+#include "my_persistent_map.h"
+#include "my_priority_queue.h"
+#include "my_ring_buffer.h"
+#include "my_skiplist_map.h"
+#include "my_skiplist_set.h"
+#include "my_spsc_queue.h"
+#include "my_unrolled_list.h"
+#include "my_work_stealing_deque.h"
 
 #endif  // MY_CONTAINERS_MY_CONTAINERSPLUS_H
\ No newline at end of file
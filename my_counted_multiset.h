@@ -0,0 +1,206 @@
+#ifndef MY_CONTAINERS_MY_COUNTED_MULTISET_H
+#define MY_CONTAINERS_MY_COUNTED_MULTISET_H
+
+#include <initializer_list>
+#include <utility>
+
+#include "my_tree.h"
+
+namespace mycontainers {
+
+// Multiset that keeps every distinct key once together with the number of
+// its copies, so insert, erase and count take O(log d) for d distinct keys
+// however many duplicates there are. Iteration still yields each copy.
+template <class Key>
+class MyCountedMultiset {
+  class CountedMultisetIterator;
+  using tree_type = BinaryTree<Key, size_t>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = CountedMultisetIterator;
+  using const_iterator = CountedMultisetIterator;
+  using size_type = size_t;
+
+  MyCountedMultiset() : tree_() {}
+  MyCountedMultiset(std::initializer_list<value_type> const &items) {
+    for (auto &item : items) {
+      insert(item);
+    }
+  }
+  MyCountedMultiset(const MyCountedMultiset &ms)
+      : tree_(ms.tree_), size_(ms.size_) {}
+  MyCountedMultiset(MyCountedMultiset &&ms) noexcept
+      : tree_(std::move(ms.tree_)), size_(ms.size_) {
+    ms.size_ = 0;
+  }
+  ~MyCountedMultiset() = default;
+
+  MyCountedMultiset &operator=(const MyCountedMultiset &ms) {
+    MyCountedMultiset tmp(ms);
+    swap(tmp);
+    return *this;
+  }
+
+  MyCountedMultiset &operator=(MyCountedMultiset &&ms) noexcept {
+    swap(ms);
+    return *this;
+  }
+
+  iterator begin() const noexcept { return iterator(tree_.begin(), 0); }
+  iterator end() const noexcept { return iterator(tree_.end(), 0); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+  size_type distinct_size() const noexcept { return tree_.size(); }
+
+  void clear() {
+    tree_.clear();
+    size_ = 0;
+  }
+  iterator insert(const_reference value, size_type count = 1);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(MyCountedMultiset &other) {
+    std::swap(tree_, other.tree_);
+    std::swap(size_, other.size_);
+  }
+  void merge(MyCountedMultiset &other);
+
+  iterator find(const key_type &key) const noexcept {
+    return iterator(tree_.find(key), 0);
+  }
+  bool contains(const key_type &key) const noexcept {
+    return tree_.contains(key);
+  }
+  size_type count(const Key &key) const;
+  std::pair<iterator, iterator> equal_range(const Key &key) const {
+    return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+  }
+  iterator lower_bound(const Key &key) const {
+    return iterator(tree_.lower_bound(key), 0);
+  }
+  iterator upper_bound(const Key &key) const {
+    return iterator(tree_.upper_bound(key), 0);
+  }
+
+  template <typename... Args>
+  mycontainers::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    mycontainers::vector<std::pair<iterator, bool>> result;
+    (result.push_back(std::pair<iterator, bool>(insert(args), true)), ...);
+    return result;
+  }
+
+ private:
+  tree_type tree_;
+  size_type size_ = 0;
+};  // class MyCountedMultiset
+
+// Points at one copy of a key: the tree node of the key and the index of
+// the copy within its count.
+template <class Key>
+class MyCountedMultiset<Key>::CountedMultisetIterator {
+ public:
+  CountedMultisetIterator() = default;
+  CountedMultisetIterator(typename tree_type::iterator it, size_type index)
+      : it_(it), index_(index) {}
+
+  Key operator*() { return it_->first; }
+
+  bool operator==(CountedMultisetIterator it) {
+    return (it_ == it.it_ && index_ == it.index_);
+  }
+  bool operator!=(CountedMultisetIterator it) { return !(*this == it); }
+
+  CountedMultisetIterator operator++();
+  CountedMultisetIterator operator--();
+
+ private:
+  friend class MyCountedMultiset;
+
+  typename tree_type::iterator it_;
+  size_type index_ = 0;
+};  // class CountedMultisetIterator
+
+template <class Key>
+typename MyCountedMultiset<Key>::CountedMultisetIterator
+MyCountedMultiset<Key>::CountedMultisetIterator::operator++() {
+  if (++index_ >= it_->second) {
+    index_ = 0;
+    ++it_;
+  }
+  return *this;
+}
+
+template <class Key>
+typename MyCountedMultiset<Key>::CountedMultisetIterator
+MyCountedMultiset<Key>::CountedMultisetIterator::operator--() {
+  if (index_ > 0) {
+    --index_;
+  } else {
+    --it_;
+    index_ = it_->second - 1;
+  }
+  return *this;
+}
+
+template <class Key>
+typename MyCountedMultiset<Key>::iterator MyCountedMultiset<Key>::insert(
+    const_reference value, size_type count) {
+  if (!count) return lower_bound(value);
+
+  std::pair<typename tree_type::iterator, bool> result =
+      tree_.insertToTree(value, count, false);
+  if (!result.second) result.first->second += count;
+  size_ += count;
+  return iterator(result.first, result.first->second - 1);
+}
+
+// Removes the copy at pos, which with equal copies means lowering the count.
+template <class Key>
+void MyCountedMultiset<Key>::erase(iterator pos) {
+  if (pos == end()) return;
+
+  if (pos.it_->second > 1) {
+    --pos.it_->second;
+  } else {
+    tree_.erase(pos.it_);
+  }
+  --size_;
+}
+
+template <class Key>
+size_t MyCountedMultiset<Key>::erase(const key_type &key) {
+  typename tree_type::iterator it = tree_.find(key);
+  if (it == tree_.end()) return 0;
+
+  size_type count = it->second;
+  tree_.erase(it);
+  size_ -= count;
+  return count;
+}
+
+template <class Key>
+void MyCountedMultiset<Key>::merge(MyCountedMultiset &other) {
+  if (this == &other) return;
+
+  for (typename tree_type::iterator it = other.tree_.begin();
+       it != other.tree_.end(); ++it) {
+    insert(it->first, it->second);
+  }
+  other.clear();
+}
+
+template <class Key>
+size_t MyCountedMultiset<Key>::count(const Key &key) const {
+  typename tree_type::iterator it = tree_.find(key);
+  return (it == tree_.end()) ? 0 : it->second;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_COUNTED_MULTISET_H
@@ -0,0 +1,310 @@
+#ifndef MY_CONTAINERS_MY_DEQUE_H
+#define MY_CONTAINERS_MY_DEQUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mycontainers {
+
+// Double-ended sequence stored in fixed-size blocks. A map, an array of
+// block pointers, addresses the blocks in order; an element's position
+// plus start_ is split into a map index and an offset within the block, so
+// random access is two loads. Pushing at either end constructs in place in
+// the end block, allocating a block only when it is full, and never moves
+// an element: references to the elements stay valid through push and pop
+// at the ends. When the map runs out of slots at one end, the block
+// pointers are recentred in it or it doubles. Emptied blocks are kept as
+// spares until shrink_to_fit.
+template <class T>
+class deque {
+ public:
+  class DequeConstIterator;
+  class DequeIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = DequeIterator;
+  using const_iterator = DequeConstIterator;
+  using size_type = size_t;
+
+  deque() = default;
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &d);
+  deque(deque &&d) noexcept { swap(d); }
+  ~deque();
+
+  deque &operator=(const deque &d);
+  deque &operator=(deque &&d) noexcept;
+
+  reference at(size_type pos);
+  reference operator[](size_type pos) { return *slot(pos); }
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+  reference front() { return *slot(0); }
+  const_reference front() const { return *slot(0); }
+  reference back() { return *slot(size_ - 1); }
+  const_reference back() const { return *slot(size_ - 1); }
+
+  iterator begin() const { return iterator(this, 0); }
+  iterator end() const { return iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  // Frees the spare blocks; the map itself is kept.
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_front(const_reference value);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other) noexcept;
+
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+
+  // Elements per block: 512 bytes' worth, at least 16.
+  static constexpr size_type block_size() noexcept { return kBlockSize; }
+
+ private:
+  static constexpr size_type kBlockSize =
+      sizeof(T) < 32 ? 512 / sizeof(T) : 16;
+  static constexpr size_type kMinMapSize = 8;
+
+  T *slot(size_type pos) const {
+    size_type index = start_ + pos;
+    return map_[index / kBlockSize] + index % kBlockSize;
+  }
+  T *newSlot(bool front);
+  // Block range [first, last) holding the elements.
+  size_type firstBlock() const { return start_ / kBlockSize; }
+  size_type lastBlock() const {
+    return size_ ? (start_ + size_ - 1) / kBlockSize + 1 : firstBlock();
+  }
+  void remap();
+
+  T **map_ = nullptr;
+  size_type mapSize_ = 0;
+  size_type start_ = 0;
+  size_type size_ = 0;
+};  // class deque
+
+template <class T>
+class deque<T>::DequeConstIterator {
+ public:
+  DequeConstIterator() = default;
+  DequeConstIterator(const deque *d, size_type pos) : deque_(d), pos_(pos) {}
+
+  const T &operator*() const { return *deque_->slot(pos_); }
+  DequeConstIterator operator++() {
+    ++pos_;
+    return *this;
+  }
+  DequeConstIterator operator--() {
+    --pos_;
+    return *this;
+  }
+  bool operator==(const DequeConstIterator it) const {
+    return pos_ == it.pos_ && deque_ == it.deque_;
+  }
+  bool operator!=(const DequeConstIterator it) const { return !(*this == it); }
+  size_type operator-(const DequeConstIterator it) const {
+    return pos_ - it.pos_;
+  }
+
+ protected:
+  const deque *deque_ = nullptr;
+  size_type pos_ = 0;
+};  // class DequeConstIterator
+
+template <class T>
+class deque<T>::DequeIterator : public DequeConstIterator {
+ public:
+  using DequeConstIterator::DequeConstIterator;
+
+  T &operator*() const { return *this->deque_->slot(this->pos_); }
+  DequeIterator operator++() {
+    ++this->pos_;
+    return *this;
+  }
+  DequeIterator operator--() {
+    --this->pos_;
+    return *this;
+  }
+};  // class DequeIterator
+
+template <class T>
+deque<T>::deque(std::initializer_list<value_type> const &items) {
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T>
+deque<T>::deque(const deque &d) {
+  for (size_type i = 0; i < d.size_; ++i) push_back(d[i]);
+}
+
+template <class T>
+deque<T>::~deque() {
+  clear();
+  std::allocator<T> allocator;
+  for (size_type i = 0; i < mapSize_; ++i) {
+    if (map_[i]) allocator.deallocate(map_[i], kBlockSize);
+  }
+  if (map_) std::allocator<T *>().deallocate(map_, mapSize_);
+}
+
+template <class T>
+deque<T> &deque<T>::operator=(const deque &d) {
+  if (this == &d) return *this;
+  deque tmp(d);
+  swap(tmp);
+  return *this;
+}
+
+template <class T>
+deque<T> &deque<T>::operator=(deque &&d) noexcept {
+  if (this == &d) return *this;
+  clear();
+  swap(d);
+  return *this;
+}
+
+template <class T>
+T &deque<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("mycontainers::deque::at");
+  }
+  return *slot(pos);
+}
+
+template <class T>
+size_t deque<T>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(T);
+}
+
+template <class T>
+void deque<T>::shrink_to_fit() {
+  std::allocator<T> allocator;
+  size_type first = firstBlock(), last = lastBlock();
+  for (size_type i = 0; i < mapSize_; ++i) {
+    if (map_[i] && (i < first || i >= last)) {
+      allocator.deallocate(map_[i], kBlockSize);
+      map_[i] = nullptr;
+    }
+  }
+}
+
+// Restarts from the middle of the map, so that both ends have room.
+template <class T>
+void deque<T>::clear() noexcept {
+  for (size_type i = 0; i < size_; ++i) slot(i)->~T();
+  start_ = mapSize_ / 2 * kBlockSize;
+  size_ = 0;
+}
+
+// Blocks never move, so value may be one of the elements. The slow path,
+// a missing block or map slot, is kept out of line.
+template <class T>
+void deque<T>::push_back(const_reference value) {
+  size_type index = start_ + size_;
+  T *block = index / kBlockSize < mapSize_ ? map_[index / kBlockSize] : nullptr;
+  new (block ? block + index % kBlockSize : newSlot(false)) T(value);
+  ++size_;
+}
+
+template <class T>
+void deque<T>::push_front(const_reference value) {
+  size_type index = start_ - 1;
+  T *block = start_ ? map_[index / kBlockSize] : nullptr;
+  new (block ? block + index % kBlockSize : newSlot(true)) T(value);
+  --start_;
+  ++size_;
+}
+
+template <class T>
+void deque<T>::pop_back() {
+  if (!size_) return;
+  slot(size_ - 1)->~T();
+  --size_;
+}
+
+template <class T>
+void deque<T>::pop_front() {
+  if (!size_) return;
+  slot(0)->~T();
+  ++start_;
+  --size_;
+}
+
+template <class T>
+void deque<T>::swap(deque &other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(mapSize_, other.mapSize_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+template <class T>
+template <class... Args>
+void deque<T>::insert_many_back(Args &&...args) {
+  (push_back(args), ...);
+}
+
+// The slot for a new element at the front or back, remapping and
+// allocating its block as needed.
+template <class T>
+T *deque<T>::newSlot(bool front) {
+  if (front ? start_ == 0 : (start_ + size_) / kBlockSize >= mapSize_) {
+    remap();
+  }
+  size_type index = front ? start_ - 1 : start_ + size_;
+  T *&block = map_[index / kBlockSize];
+  if (!block) block = std::allocator<T>().allocate(kBlockSize);
+  return block + index % kBlockSize;
+}
+
+// Called when an end of the map is reached. Moves the used block pointers
+// to the middle of a map with at least two free slots on each side, the
+// same map if the used blocks take no more than half of it and a doubled
+// one otherwise; spare blocks are placed right after and before them. Each
+// call frees a quarter of the map at the full end, so its O(map) cost is
+// amortized over as many blocks.
+template <class T>
+void deque<T>::remap() {
+  size_type first = firstBlock(), last = lastBlock();
+  size_type used = last - first;
+  size_type mapSize = mapSize_ ? mapSize_ : kMinMapSize;
+  if (used + 4 > mapSize / 2) mapSize *= 2;
+  std::allocator<T *> allocator;
+  T **map = allocator.allocate(mapSize);
+  for (size_type i = 0; i < mapSize; ++i) map[i] = nullptr;
+  size_type newFirst = (mapSize - used) / 2;
+  for (size_type i = 0; i < used; ++i) map[newFirst + i] = map_[first + i];
+  size_type after = newFirst + used, before = newFirst;
+  for (size_type i = 0; i < mapSize_; ++i) {
+    if (!map_[i] || (i >= first && i < last)) continue;
+    if (after < mapSize) {
+      map[after++] = map_[i];
+    } else if (before > 0) {
+      map[--before] = map_[i];
+    } else {
+      std::allocator<T>().deallocate(map_[i], kBlockSize);
+    }
+  }
+  if (map_) allocator.deallocate(map_, mapSize_);
+  start_ = newFirst * kBlockSize + start_ % kBlockSize;
+  map_ = map;
+  mapSize_ = mapSize;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_DEQUE_H
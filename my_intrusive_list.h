@@ -0,0 +1,363 @@
+#ifndef MY_CONTAINERS_MY_INTRUSIVE_LIST_H
+#define MY_CONTAINERS_MY_INTRUSIVE_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "my_list_links.h"
+#include "my_parallel.h"
+
+namespace mycontainers {
+
+template <class T, auto Hook>
+class intrusive_list;
+
+// Links embedded in an object so that intrusive_list chains the object
+// itself rather than a copy. An object may sit in as many lists as it has
+// hooks. Copying an object does not copy its place in a list.
+class list_hook : private ListLinks {
+ public:
+  list_hook() : ListLinks(nullptr, nullptr) {}
+  list_hook(const list_hook &) : list_hook() {}
+  list_hook &operator=(const list_hook &) { return *this; }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ protected:
+  void unlink() noexcept {
+    if (!is_linked()) return;
+    list_links::unlink(this);
+    next_ = prev_ = nullptr;
+  }
+
+ private:
+  template <class T, auto Hook>
+  friend class intrusive_list;
+};
+
+// Hook that takes its object out of the list when the object is destroyed
+// or on unlink(), in O(1) and without access to the list.
+class auto_unlink_hook : public list_hook {
+ public:
+  auto_unlink_hook() = default;
+  auto_unlink_hook(const auto_unlink_hook &) : list_hook() {}
+  auto_unlink_hook &operator=(const auto_unlink_hook &) { return *this; }
+  ~auto_unlink_hook() { unlink(); }
+
+  using list_hook::unlink;
+};
+
+// Doubly linked list of objects that live elsewhere, chained through the
+// hook member Hook of T: intrusive_list<Timer, &Timer::hook>. The list
+// never allocates, copies or destroys its elements; removing an object
+// only unlinks it. An object must outlive its membership in the list,
+// unless Hook is an auto_unlink_hook.
+template <class T, auto Hook>
+class intrusive_list {
+  using hook_type = std::remove_reference_t<decltype(std::declval<T &>().*
+                                                     Hook)>;
+  static_assert(std::is_base_of_v<list_hook, hook_type>,
+                "Hook must point to a list_hook member of T");
+
+ public:
+  class IntrusiveListConstIterator;
+  class IntrusiveListIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = IntrusiveListIterator;
+  using const_iterator = IntrusiveListConstIterator;
+  using size_type = size_t;
+
+  intrusive_list() = default;
+  intrusive_list(const intrusive_list &l) = delete;
+  intrusive_list(intrusive_list &&l) noexcept { splice(cend(), l); }
+  ~intrusive_list() { clear(); }
+
+  intrusive_list &operator=(const intrusive_list &l) = delete;
+  intrusive_list &operator=(intrusive_list &&l) noexcept;
+
+  reference front() const { return *owner(sentinel_.next_); }
+  reference back() const { return *owner(sentinel_.prev_); }
+
+  iterator begin() const { return iterator(sentinel_.next_); }
+  iterator end() const { return iterator(sentinel()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+  // Iterator to value, which must be linked into this list.
+  iterator iterator_to(reference value) const { return iterator(links(value)); }
+
+  bool empty() const noexcept { return sentinel_.next_ == &sentinel_; }
+  size_type size() const;
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+  }
+
+  // Unlinks every object; none of them is destroyed.
+  void clear();
+  iterator insert(const_iterator pos, reference value);
+  iterator erase(const_iterator pos);
+  void push_back(reference value) { insert(cend(), value); }
+  void pop_back() { erase(--end()); }
+  void push_front(reference value) { insert(cbegin(), value); }
+  void pop_front() { erase(begin()); }
+  void swap(intrusive_list &other);
+  template <class Compare = std::less<T>>
+  void merge(intrusive_list &other, Compare comp = Compare());
+  void splice(const_iterator pos, intrusive_list &other);
+  void splice(const_iterator pos, intrusive_list &other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator first, const_iterator last);
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator first, const_iterator last, size_type count);
+  void reverse() { list_links::reverse(&sentinel_); }
+  void unique();
+  // Stable natural merge sort shared with list. Like merge, it leaves the
+  // lists as they were if comp throws.
+  template <class Compare = std::less<T>>
+  void sort(Compare comp = Compare(), bool parallel = false);
+
+ private:
+  // With auto_unlink_hook objects leave the list on their own, so size_
+  // is exact only for plain hooks and size() counts the links otherwise.
+  static constexpr bool kCountedSize =
+      !std::is_base_of_v<auto_unlink_hook, hook_type>;
+
+  ListLinks *sentinel() const { return const_cast<ListLinks *>(&sentinel_); }
+  static ListLinks *links(reference value);
+  static T *owner(const ListLinks *link);
+  template <class Compare>
+  static auto linkLess(Compare comp);
+
+  // Byte offset of the hook within T, or -1 until an object is linked.
+  static inline std::atomic<std::ptrdiff_t> hookOffset_{-1};
+
+  ListLinks sentinel_;
+  size_type size_ = 0;
+};  // class intrusive_list
+
+template <class T, auto Hook>
+class intrusive_list<T, Hook>::IntrusiveListConstIterator {
+ public:
+  IntrusiveListConstIterator() = default;
+  IntrusiveListConstIterator(ListLinks *ptr) : ptr_(ptr) {}
+
+  const T &operator*() const { return *owner(ptr_); }
+  const T *operator->() const { return owner(ptr_); }
+  IntrusiveListConstIterator operator++() {
+    ptr_ = ptr_->next_;
+    return *this;
+  }
+  IntrusiveListConstIterator operator--() {
+    ptr_ = ptr_->prev_;
+    return *this;
+  }
+  bool operator==(const IntrusiveListConstIterator it) const {
+    return ptr_ == it.ptr_;
+  }
+  bool operator!=(const IntrusiveListConstIterator it) const {
+    return ptr_ != it.ptr_;
+  }
+
+  ListLinks *Get() const { return ptr_; }
+
+ protected:
+  ListLinks *ptr_ = nullptr;
+};  // class IntrusiveListConstIterator
+
+template <class T, auto Hook>
+class intrusive_list<T, Hook>::IntrusiveListIterator
+    : public IntrusiveListConstIterator {
+ public:
+  using IntrusiveListConstIterator::IntrusiveListConstIterator;
+
+  T &operator*() const { return *owner(this->ptr_); }
+  T *operator->() const { return owner(this->ptr_); }
+  IntrusiveListIterator operator++() {
+    this->ptr_ = this->ptr_->next_;
+    return *this;
+  }
+  IntrusiveListIterator operator--() {
+    this->ptr_ = this->ptr_->prev_;
+    return *this;
+  }
+};  // class IntrusiveListIterator
+
+template <class T, auto Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(
+    intrusive_list &&l) noexcept {
+  if (this == &l) return *this;
+  clear();
+  splice(cend(), l);
+  return *this;
+}
+
+template <class T, auto Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size()
+    const {
+  if constexpr (kCountedSize) {
+    return size_;
+  } else {
+    size_type count = 0;
+    for (const ListLinks *node = sentinel_.next_; node != &sentinel_;
+         node = node->next_) {
+      ++count;
+    }
+    return count;
+  }
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::clear() {
+  ListLinks *node = sentinel_.next_;
+  while (node != &sentinel_) {
+    ListLinks *next = node->next_;
+    node->next_ = node->prev_ = nullptr;
+    node = next;
+  }
+  sentinel_.next_ = sentinel_.prev_ = &sentinel_;
+  size_ = 0;
+}
+
+template <class T, auto Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  ListLinks *node = links(value);
+  list_links::linkBefore(pos.Get(), node);
+  ++size_;
+  return iterator(node);
+}
+
+// Unlinks the object at pos and returns the iterator to the next one.
+template <class T, auto Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) {
+  ListLinks *node = pos.Get();
+  if (node == &sentinel_) return end();
+  ListLinks *next = node->next_;
+  list_links::unlink(node);
+  node->next_ = node->prev_ = nullptr;
+  --size_;
+  return iterator(next);
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) {
+  if (this == &other) return;
+  intrusive_list tmp(std::move(other));
+  other.splice(other.cend(), *this);
+  splice(cend(), tmp);
+}
+
+template <class T, auto Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list &other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  auto less = linkLess(comp);
+  list_links::mergeRings(&sentinel_, &other.sentinel_, less);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other) {
+  if (this == &other) return;
+  list_links::splice(pos.Get(), &other.sentinel_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other,
+                                     const_iterator it) {
+  ListLinks *node = it.Get();
+  if (pos.Get() == node || pos.Get() == node->next_) return;
+  list_links::splice(pos.Get(), node, node->next_);
+  ++size_;
+  --other.size_;
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  size_type count = 0;
+  if (kCountedSize && this != &other) {
+    for (const_iterator it = first; it != last; ++it) ++count;
+  }
+  splice(pos, other, first, last, count);
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other,
+                                     const_iterator first,
+                                     const_iterator last, size_type count) {
+  list_links::splice(pos.Get(), first.Get(), last.Get());
+  if (this == &other) return;
+  size_ += count;
+  other.size_ -= count;
+}
+
+template <class T, auto Hook>
+void intrusive_list<T, Hook>::unique() {
+  if (empty()) return;
+  ListLinks *node = sentinel_.next_;
+  while (node->next_ != &sentinel_) {
+    if (*owner(node) == *owner(node->next_)) {
+      erase(const_iterator(node->next_));
+    } else {
+      node = node->next_;
+    }
+  }
+}
+
+template <class T, auto Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::sort(Compare comp, bool parallel) {
+  size_type count = size();
+  if (count <= 1) return;
+  int depth = parallel ? parallelDepth() : 0;
+  list_links::sortRing(&sentinel_, count, linkLess(comp), depth);
+}
+
+// A member pointer gives no offset by itself, so it is measured on the
+// first real object that passes through here. Every object enters a list
+// through links(), so owner() never runs before the offset is known.
+template <class T, auto Hook>
+ListLinks *intrusive_list<T, Hook>::links(reference value) {
+  list_hook *hook = static_cast<list_hook *>(&(value.*Hook));
+  if (hookOffset_.load(std::memory_order_relaxed) < 0) {
+    hookOffset_.store(reinterpret_cast<unsigned char *>(hook) -
+                          reinterpret_cast<unsigned char *>(&value),
+                      std::memory_order_relaxed);
+  }
+  return hook;
+}
+
+template <class T, auto Hook>
+T *intrusive_list<T, Hook>::owner(const ListLinks *link) {
+  const unsigned char *hook = reinterpret_cast<const unsigned char *>(
+      static_cast<const list_hook *>(link));
+  return reinterpret_cast<T *>(const_cast<unsigned char *>(
+      hook - hookOffset_.load(std::memory_order_relaxed)));
+}
+
+template <class T, auto Hook>
+template <class Compare>
+auto intrusive_list<T, Hook>::linkLess(Compare comp) {
+  return [comp](const ListLinks *a, const ListLinks *b) mutable {
+    return comp(*owner(a), *owner(b));
+  };
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_INTRUSIVE_LIST_H
@@ -0,0 +1,27 @@
+#ifndef MY_CONTAINERS_MY_ITERATOR_H
+#define MY_CONTAINERS_MY_ITERATOR_H
+
+#include <iterator>
+#include <type_traits>
+
+namespace mycontainers {
+
+// Whether a range of It may be walked twice, so that the containers can
+// count it with std::distance and reserve before copying. Iterators without
+// iterator_traits are taken for input iterators.
+template <class It, class = void>
+struct is_forward_iterator : std::false_type {};
+
+template <class It>
+struct is_forward_iterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {
+};
+
+template <class It>
+inline constexpr bool is_forward_iterator_v = is_forward_iterator<It>::value;
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_ITERATOR_H
@@ -1,9 +1,29 @@
 #ifndef MY_CONTAINERS_MY_LIST_H
 #define MY_CONTAINERS_MY_LIST_H
 
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "my_iterator.h"
+#include "my_list_links.h"
+#include "my_parallel.h"
+
 namespace mycontainers {
 template <class T>
 class list {
+  using NodeBase = ListLinks;
+
  public:
   class ListIterator;
   class ListConstIterator;
@@ -19,6 +39,9 @@ class list {
   list();
   list(size_type n);
   list(std::initializer_list<value_type> const &items);
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  list(InputIt first, InputIt last);
   list(const list &l);
   list(list &&l) noexcept;
   ~list();
@@ -26,8 +49,18 @@ class list {
   list &operator=(const list &l);
   list &operator=(list &&l) noexcept;
 
-  const_reference front() const { return head_->value_; }
-  const_reference back() const { return tail_->prev_->value_; }
+  // Assigns to the existing elements first, so no node is allocated unless
+  // the list grows; the spare nodes are kept for reuse.
+  void assign(size_type n, const_reference value);
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> const &items);
+
+  reference front() { return value(sentinel_.next_); }
+  const_reference front() const { return value(sentinel_.next_); }
+  reference back() { return value(sentinel_.prev_); }
+  const_reference back() const { return value(sentinel_.prev_); }
 
   iterator begin() const;
   iterator end() const;
@@ -37,7 +70,12 @@ class list {
   bool empty() const noexcept;
   size_type size() const { return size_; }
   size_type max_size() const;
+  // Number of elements the list can hold before allocating again.
+  size_type capacity() const { return size_ + freeCount_; }
+  void reserve(size_type n);
+  void shrink_to_fit();
 
+  // Keeps the memory of the removed nodes for reuse; see shrink_to_fit().
   void clear();
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
@@ -46,11 +84,30 @@ class list {
   void push_front(const_reference value);
   void pop_front();
   void swap(list &other);
+  // Only relinks nodes; if operator< throws, both lists stay as they were.
   void merge(list &other);
   void splice(const_iterator pos, list &other);
+  void splice(const_iterator pos, list &other, const_iterator it);
+  // Walks [first, last) to count it when other is another list; pass the
+  // count to the overload below to make the move O(1).
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last);
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last, size_type count);
   void reverse();
-  void unique();
-  void sort();
+  // The removals below unlink the matching nodes in one pass and destroy
+  // them together at the end, so value may refer to an element of the list.
+  size_type remove(const_reference value);
+  template <class Predicate>
+  size_type remove_if(Predicate pred);
+  // Removes every element for which pred(first of its run, element) holds.
+  template <class BinaryPredicate = std::equal_to<T>>
+  size_type unique(BinaryPredicate pred = BinaryPredicate());
+  // Stable natural merge sort, O(n) on sorted or reverse sorted input. With
+  // parallel set, long lists are cut in halves sorted on separate threads.
+  // If comp throws, on any thread, the list keeps its previous order.
+  template <class Compare = std::less<T>>
+  void sort(Compare comp = Compare(), bool parallel = false);
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
@@ -60,41 +117,82 @@ class list {
   void insert_many_front(Args &&...args);
 
   void print() {
-    Node *tmp = head_;
-    while (tmp != tail_) {
-      std::cout << tmp->value_ << " ";
-      tmp = tmp->next_;
+    for (NodeBase *node = sentinel_.next_; node != &sentinel_;
+         node = node->next_) {
+      std::cout << value(node) << " ";
     }
     std::cout << std::endl;
   };
 
  private:
+  // Header of a block of nodes allocated together by reserve(). splice,
+  // merge and swap may carry its nodes into other lists, so it counts the
+  // nodes whose memory is still in use by any list and is freed together
+  // with the last of them.
+  struct Chunk {
+    size_type count_;
+    size_type refs_;
+  };
+
+  // Every chunk of list<T>, by the address of its first node. A node does
+  // not point to its chunk, which would make it a pointer larger than a
+  // std::list node; its memory is looked up here in O(log chunks) once it
+  // is released, under mutex_ as the nodes move between lists.
+  struct ChunkRegistry {
+    std::mutex mutex_;
+    std::map<const unsigned char *, Chunk *> chunks_;
+  };
+
+  // Storage of a destroyed node waiting for reuse.
+  struct FreeNode {
+    FreeNode *next_;
+  };
+
+  // The ring of nodes is closed by sentinel_, which holds no element, so
+  // an empty list owns no memory and never constructs a T.
+  NodeBase sentinel_;
   size_type size_ = 0;
-  Node *head_;
-  Node *tail_;
+  FreeNode *free_ = nullptr;
+  size_type freeCount_ = 0;
 
-  void tail_init();
-  void mergeSort(Node **tmp, size_type size);
-  void reconnectingPrev();
-  void zeroSize();
+  static T &value(const NodeBase *node) {
+    return static_cast<Node *>(const_cast<NodeBase *>(node))->value_;
+  }
+  Node *createNode(const_reference value);
+  void destroyNode(NodeBase *node);
+  template <class Predicate>
+  size_type eraseNodes(Predicate pred);
+  void pushFree(void *memory);
+  static ChunkRegistry &registry();
+  static void releaseMemory(void *memory, ChunkRegistry &registry);
+  void linkBefore(NodeBase *pos, NodeBase *node);
+  void unlink(NodeBase *node);
+  void takeNodes(list &other);
+  template <class InputIt>
+  void appendRange(InputIt first, InputIt last);
+  void eraseFrom(NodeBase *node);
+
+  static constexpr std::size_t kChunkAlignment =
+      alignof(Chunk) > alignof(Node) ? alignof(Chunk) : alignof(Node);
+  // The nodes of a chunk start right after its header.
+  static constexpr std::size_t kChunkHeaderSize =
+      (sizeof(Chunk) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
 };
 
 template <class T>
-class list<T>::Node {
+class list<T>::Node : public NodeBase {
  public:
-  Node(T data);
+  explicit Node(const_reference data);
 
  public:
   T value_;
-  Node *next_;
-  Node *prev_;
 };
 
 template <class T>
 class list<T>::ListConstIterator {
  public:
   ListConstIterator(){};
-  ListConstIterator(Node *ptr);
+  ListConstIterator(const NodeBase *ptr);
 
   const T &operator*();
   typename list<T>::ListConstIterator operator++();
@@ -102,17 +200,17 @@ class list<T>::ListConstIterator {
   bool operator==(const ListConstIterator it);
   bool operator!=(const ListConstIterator it);
 
-  const Node *Get() { return ptr_; }
+  const NodeBase *Get() { return ptr_; }
 
  private:
-  const Node *ptr_;
+  const NodeBase *ptr_;
 };
 
 template <class T>
 class list<T>::ListIterator {
  public:
   ListIterator(){};
-  ListIterator(Node *l);
+  ListIterator(NodeBase *l);
 
   T &operator*();
   typename list<T>::ListIterator operator++();
@@ -120,20 +218,21 @@ class list<T>::ListIterator {
   bool operator==(const ListIterator it);
   bool operator!=(const ListIterator it);
 
-  Node *Get() { return ptr_; }
+  NodeBase *Get() { return ptr_; }
 
  private:
-  Node *ptr_;
+  NodeBase *ptr_;
 };
 
 // begin class const_iterator foo
 
 template <class T>
-list<T>::ListConstIterator::ListConstIterator(Node *ptr) : ptr_(ptr) {}
+list<T>::ListConstIterator::ListConstIterator(const NodeBase *ptr)
+    : ptr_(ptr) {}
 
 template <class T>
 const T &list<T>::ListConstIterator::operator*() {
-  return ptr_->value_;
+  return value(ptr_);
 }
 
 template <class T>
@@ -163,11 +262,11 @@ bool list<T>::ListConstIterator::operator!=(const ListConstIterator it) {
 // begin class iterator foo
 
 template <class T>
-list<T>::ListIterator::ListIterator(Node *n) : ptr_(n) {}
+list<T>::ListIterator::ListIterator(NodeBase *n) : ptr_(n) {}
 
 template <class T>
 T &list<T>::ListIterator::operator*() {
-  return ptr_->value_;
+  return value(ptr_);
 }
 
 template <class T>
@@ -198,30 +297,29 @@ bool list<T>::ListIterator::operator!=(const ListIterator it) {
 
 template <class T>
 void list<T>::clear() {
-  while (head_ != tail_) {
+  while (size_) {
     pop_front();
   }
-  tail_->prev_ = tail_;
 }
 
 template <class T>
 typename list<T>::iterator list<T>::end() const {
-  return iterator(tail_);
+  return iterator(const_cast<NodeBase *>(&sentinel_));
 }
 
 template <class T>
 typename list<T>::iterator list<T>::begin() const {
-  return iterator(head_);
+  return iterator(sentinel_.next_);
 }
 
 template <class T>
 typename list<T>::const_iterator list<T>::cend() const {
-  return const_iterator(tail_);
+  return const_iterator(&sentinel_);
 }
 
 template <class T>
 typename list<T>::const_iterator list<T>::cbegin() const {
-  return const_iterator(head_);
+  return const_iterator(sentinel_.next_);
 }
 
 template <class T>
@@ -234,351 +332,448 @@ size_t list<T>::max_size() const {
   return std::numeric_limits<std::size_t>::max() / sizeof(Node) / 2;
 }
 
+// Allocates the missing nodes in one chunk. They are queued in the order
+// of their addresses, so that a list filled from them right after is laid
+// out contiguously in that order.
+template <class T>
+void list<T>::reserve(size_type n) {
+  if (n <= capacity()) return;
+  if (n > max_size()) throw std::length_error("mycontainers::list::reserve");
+  size_type count = n - capacity();
+  void *memory = ::operator new(kChunkHeaderSize + count * sizeof(Node),
+                                std::align_val_t(kChunkAlignment));
+  Chunk *chunk = new (memory) Chunk{count, count};
+  unsigned char *nodes = static_cast<unsigned char *>(memory) +
+                         kChunkHeaderSize;
+  try {
+    ChunkRegistry &chunks = registry();
+    std::lock_guard<std::mutex> lock(chunks.mutex_);
+    chunks.chunks_.emplace(nodes, chunk);
+  } catch (...) {
+    ::operator delete(memory, std::align_val_t(kChunkAlignment));
+    throw;
+  }
+  for (size_type i = count; i > 0; --i) {
+    pushFree(nodes + (i - 1) * sizeof(Node));
+  }
+}
+
+// A chunk is freed once none of its nodes is in use, here or in the lists
+// its nodes were moved to.
 template <class T>
-list<T>::Node::Node(T data) {
-  next_ = prev_ = nullptr;
-  value_ = data;
+void list<T>::shrink_to_fit() {
+  if (!free_) return;
+  ChunkRegistry &chunks = registry();
+  std::lock_guard<std::mutex> lock(chunks.mutex_);
+  while (free_) {
+    FreeNode *node = free_;
+    free_ = node->next_;
+    releaseMemory(node, chunks);
+  }
+  freeCount_ = 0;
 }
 
+// Takes a node kept for reuse, which may come from a chunk, or allocates
+// one on its own when there is none.
 template <class T>
-void list<T>::tail_init() {
-  Node *tmp = new Node(T());
-  size_ = 0;
-  head_ = tmp;
-  tail_ = tmp;
-  tmp->next_ = tmp;
-  tmp->prev_ = tmp;
-};
+typename list<T>::Node *list<T>::createNode(const_reference value) {
+  void *memory = nullptr;
+  if (free_) {
+    memory = free_;
+    free_ = free_->next_;
+    --freeCount_;
+  } else {
+    memory = std::allocator<Node>().allocate(1);
+  }
+  try {
+    return new (memory) Node(value);
+  } catch (...) {
+    pushFree(memory);
+    throw;
+  }
+}
 
 template <class T>
-list<T>::list() {
-  tail_init();
-};
+void list<T>::destroyNode(NodeBase *node) {
+  Node *full = static_cast<Node *>(node);
+  full->~Node();
+  pushFree(full);
+}
+
+// Unlinks the nodes for which pred holds into a chain and destroys them
+// once the walk is over, even if pred throws. Returns their number.
+template <class T>
+template <class Predicate>
+typename list<T>::size_type list<T>::eraseNodes(Predicate pred) {
+  NodeBase *removed = nullptr;
+  NodeBase **tail = &removed;
+  auto destroyRemoved = [this, &removed, &tail] {
+    *tail = nullptr;
+    size_type count = 0;
+    while (removed) {
+      NodeBase *next = removed->next_;
+      destroyNode(removed);
+      removed = next;
+      ++count;
+    }
+    return count;
+  };
+  try {
+    for (NodeBase *node = sentinel_.next_; node != &sentinel_;) {
+      NodeBase *next = node->next_;
+      if (pred(node)) {
+        unlink(node);
+        *tail = node;
+        tail = &node->next_;
+      }
+      node = next;
+    }
+  } catch (...) {
+    destroyRemoved();
+    throw;
+  }
+  return destroyRemoved();
+}
+
+template <class T>
+void list<T>::pushFree(void *memory) {
+  free_ = new (memory) FreeNode{free_};
+  ++freeCount_;
+}
+
+// Never destroyed, so that lists with static storage may outlive it.
+template <class T>
+typename list<T>::ChunkRegistry &list<T>::registry() {
+  static ChunkRegistry *chunks = new ChunkRegistry;
+  return *chunks;
+}
+
+// A node is from the chunk starting last at or before its address, if the
+// chunk reaches that far; any other node was allocated on its own. The
+// caller holds the registry mutex.
+template <class T>
+void list<T>::releaseMemory(void *memory, ChunkRegistry &registry) {
+  auto *address = static_cast<const unsigned char *>(memory);
+  auto it = registry.chunks_.upper_bound(address);
+  if (it != registry.chunks_.begin()) {
+    --it;
+    Chunk *chunk = it->second;
+    const unsigned char *end = it->first + chunk->count_ * sizeof(Node);
+    if (std::less<const unsigned char *>()(address, end)) {
+      if (--chunk->refs_ == 0) {
+        registry.chunks_.erase(it);
+        chunk->~Chunk();
+        ::operator delete(chunk, std::align_val_t(kChunkAlignment));
+      }
+      return;
+    }
+  }
+  std::allocator<Node>().deallocate(static_cast<Node *>(memory), 1);
+}
+
+template <class T>
+void list<T>::linkBefore(NodeBase *pos, NodeBase *node) {
+  list_links::linkBefore(pos, node);
+  ++size_;
+}
+
+template <class T>
+void list<T>::unlink(NodeBase *node) {
+  list_links::unlink(node);
+  --size_;
+}
+
+// Links the elements of [first, last) at the end. On an exception the
+// elements appended so far stay in the list.
+template <class T>
+template <class InputIt>
+void list<T>::appendRange(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    linkBefore(&sentinel_, createNode(*first));
+  }
+}
+
+// Destroys the elements from node to the end.
+template <class T>
+void list<T>::eraseFrom(NodeBase *node) {
+  while (node != &sentinel_) {
+    NodeBase *next = node->next_;
+    unlink(node);
+    destroyNode(node);
+    node = next;
+  }
+}
+
+// Moves the nodes of other into this list, which must be empty. The nodes
+// kept for reuse stay with other.
+template <class T>
+void list<T>::takeNodes(list &other) {
+  list_links::splice(&sentinel_, &other.sentinel_);
+  size_ = other.size_;
+  other.size_ = 0;
+}
+
+template <class T>
+list<T>::Node::Node(const_reference data) : value_(data) {}
+
+template <class T>
+list<T>::list() {}
 
 template <class T>
 list<T>::list(size_type n) {
-  tail_init();
-  for (size_type i = 0; i < n; ++i) {
-    push_back(T());
+  try {
+    reserve(n);
+    for (size_type i = 0; i < n; ++i) {
+      linkBefore(&sentinel_, createNode(T()));
+    }
+  } catch (...) {
+    clear();
+    shrink_to_fit();
+    throw;
   }
-};
+}
+
+template <class T>
+list<T>::list(std::initializer_list<value_type> const &items)
+    : list(items.begin(), items.end()) {}
 
+// The length of the range is unknown for input iterators, so the nodes are
+// reserved up front only when it can be counted.
 template <class T>
-list<T>::list(std::initializer_list<value_type> const &items) {
-  tail_init();
-  auto iter = items.begin();
-  for (size_type i = 0; i < items.size(); ++i) {
-    push_back(*(iter + i));
+template <class InputIt, class>
+list<T>::list(InputIt first, InputIt last) {
+  try {
+    if constexpr (is_forward_iterator_v<InputIt>) {
+      reserve(std::distance(first, last));
+    }
+    appendRange(first, last);
+  } catch (...) {
+    clear();
+    shrink_to_fit();
+    throw;
   }
-};
+}
 
 template <class T>
 list<T>::list(const list &l) {
-  tail_init();
-  Node *ptr = l.head_;
-  for (size_type i = 0; i < l.size_; ++i) {
-    push_back(ptr->value_);
-    ptr = ptr->next_;
+  try {
+    reserve(l.size_);
+    appendRange(l.cbegin(), l.cend());
+  } catch (...) {
+    clear();
+    shrink_to_fit();
+    throw;
   }
-};
+}
 
 template <class T>
 list<T>::list(list &&l) noexcept {
-  tail_init();
-  std::swap(size_, l.size_);
-  std::swap(head_, l.head_);
-  std::swap(tail_, l.tail_);
+  takeNodes(l);
 };
 
 template <class T>
 list<T>::~list() {
-  while (head_ != tail_) {
-    pop_front();
-  }
-  delete tail_;
+  clear();
+  shrink_to_fit();
 };
 
 template <class T>
 list<T> &list<T>::operator=(list &&l) noexcept {
   if (this == &l) return *this;
-  size_ = 0;
-  std::swap(head_, l.head_);
-  std::swap(size_, l.size_);
-  std::swap(tail_, l.tail_);
+  clear();
+  takeNodes(l);
   return *this;
 }
 
 template <class T>
 list<T> &list<T>::operator=(const list &l) {
   if (this == &l) return *this;
-  list<T> tmp(l);
-  *this = std::move(tmp);
+  reserve(l.size_);
+  assign(l.cbegin(), l.cend());
   return *this;
 }
 
 template <class T>
-void list<T>::push_back(const_reference value) {
-  Node *tmp = new Node(value);
-  size_++;
-  tail_->value_ = size_;
-  tmp->next_ = tail_;
-  tmp->prev_ = tail_->prev_;
-  tail_->prev_ = tmp;
-  if (head_ == tail_) {
-    head_ = tmp;
-    tail_->next_ = head_;
-  } else {
-    Node *ptr = tmp->prev_;
-    ptr->next_ = tmp;
+void list<T>::assign(size_type n, const_reference value) {
+  NodeBase *node = sentinel_.next_;
+  for (; n && node != &sentinel_; --n, node = node->next_) {
+    list<T>::value(node) = value;
   }
+  eraseFrom(node);
+  reserve(size_ + n);
+  for (; n; --n) linkBefore(&sentinel_, createNode(value));
+}
+
+template <class T>
+template <class InputIt, class>
+void list<T>::assign(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    reserve(std::distance(first, last));
+  }
+  NodeBase *node = sentinel_.next_;
+  for (; first != last && node != &sentinel_; ++first, node = node->next_) {
+    value(node) = *first;
+  }
+  eraseFrom(node);
+  appendRange(first, last);
+}
+
+template <class T>
+void list<T>::assign(std::initializer_list<value_type> const &items) {
+  assign(items.begin(), items.end());
+}
+
+template <class T>
+void list<T>::push_back(const_reference value) {
+  linkBefore(&sentinel_, createNode(value));
 };
 
 template <class T>
 void list<T>::push_front(const_reference value) {
-  Node *tmp = new Node(value);
-  size_++;
-  tail_->value_ = size_;
-  tmp->next_ = head_;
-  tmp->prev_ = tail_;
-  tail_->next_ = tmp;
-  if (head_ != tail_) {
-    Node *ptr = head_;
-    ptr->prev_ = tmp;
-  }
-  head_ = tmp;
+  linkBefore(sentinel_.next_, createNode(value));
 };
 
 template <class T>
 typename list<T>::iterator list<T>::insert(iterator pos,
                                            const_reference value) {
-  Node *elem = new Node(value);
-  size_++;
-  tail_->value_ = size_;
-  Node *tmp = pos.Get();
-  elem->prev_ = tmp->prev_;
-  tmp->prev_->next_ = elem;
-  elem->next_ = tmp;
-  tmp->prev_ = elem;
+  Node *elem = createNode(value);
+  linkBefore(pos.Get(), elem);
   return iterator(elem);
 }
 
 template <class T>
 void list<T>::erase(iterator pos) {
-  Node *tmp = pos.Get();
-  size_--;
-  tail_->value_ = size_;
-  tmp->prev_->next_ = tmp->next_;
-  tmp->next_->prev_ = tmp->prev_;
-  delete tmp;
+  NodeBase *node = pos.Get();
+  if (node == &sentinel_) return;
+  unlink(node);
+  destroyNode(node);
 }
 
 template <class T>
 void list<T>::pop_front() {
-  if (head_ != tail_) {
-    Node *tmp = head_;
-    head_ = tmp->next_;
-    tmp->prev_ = tail_;
-    tail_->next_ = head_;
-    delete tmp;
-    size_--;
-    tail_->value_ = size_;
+  if (size_) {
+    NodeBase *node = sentinel_.next_;
+    unlink(node);
+    destroyNode(node);
   }
 }
 
 template <class T>
 void list<T>::pop_back() {
-  if (tail_ != head_) {
-    Node *tmp = tail_->prev_;
-    tmp->prev_->next_ = tail_;
-    tail_->prev_ = tmp->prev_;
-    head_ = tail_->next_;
-    delete tmp;
-    size_--;
-    tail_->value_ = size_;
+  if (size_) {
+    NodeBase *node = sentinel_.prev_;
+    unlink(node);
+    destroyNode(node);
   }
 }
 
 template <class T>
 void list<T>::swap(list &other) {
-  std::swap(size_, other.size_);
-  std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
+  if (this == &other) return;
+  list<T> tmp(std::move(other));
+  other.takeNodes(*this);
+  takeNodes(tmp);
 }
 
 template <class T>
 void list<T>::merge(list &other) {
-  if (this == &other) return;
-  Node *fir = head_;
-  Node *sec = other.head_;
-  Node *res = tail_;
-  while (fir != tail_ && sec != other.tail_) {
-    if (fir->value_ <= sec->value_) {
-      res->next_ = fir;
-      fir = fir->next_;
-    } else {
-      res->next_ = sec;
-      sec = sec->next_;
-    }
-    res = res->next_;
-  }
-  if (fir != tail_) {
-    res->next_ = fir;
-  } else {
-    res->next_ = sec;
-    other.tail_->prev_->next_ = tail_;
-  }
-  head_ = tail_->next_;
-  head_->prev_ = tail_;
-  reconnectingPrev();
+  if (this == &other || !other.size_) return;
+  auto less = [](const NodeBase *a, const NodeBase *b) {
+    return value(a) < value(b);
+  };
+  list_links::mergeRings(&sentinel_, &other.sentinel_, less);
   size_ += other.size_;
-  tail_->value_ = size_;
-  other.zeroSize();
+  other.size_ = 0;
 }
 
 template <class T>
 void list<T>::splice(const_iterator pos, list &other) {
-  if (!other.size_) return;
-  if (!size_) {
-    tail_->next_ = other.tail_->next_;
-    tail_->prev_ = other.tail_->prev_;
-    other.tail_->prev_->next_ = tail_;
-    head_ = tail_->next_;
-    head_->prev_ = tail_;
-  } else if (pos.Get() == head_) {
-    Node *tmp = head_;
-    head_ = other.head_;
-    head_->prev_ = tail_;
-    tail_->next_ = head_;
-    tmp->prev_ = other.tail_->prev_;
-    other.tail_->prev_->next_ = tmp;
-  } else {
-    Node *tmp = pos.Get()->prev_;
-    Node *tmp2 = tmp->next_;
-    tmp2->prev_ = other.tail_->prev_;
-    other.tail_->prev_->next_ = tmp2;
-    tmp->next_ = other.head_;
-    other.head_->prev_ = tmp;
-  }
+  if (this == &other) return;
+  list_links::splice(const_cast<NodeBase *>(pos.Get()), &other.sentinel_);
   size_ += other.size_;
-  tail_->value_ = size_;
-  other.zeroSize();
+  other.size_ = 0;
 }
 
 template <class T>
-void list<T>::reverse() {
-  Node *tmp = head_;
-  head_ = tail_->prev_;
-  while (tmp != tail_) {
-    Node *tmp2 = tmp->next_;
-    tmp->next_ = tmp->prev_;
-    tmp->prev_ = tmp2;
-    tmp = tmp->prev_;
-  }
-  tmp = tail_->next_;
-  tail_->next_ = tail_->prev_;
-  tail_->prev_ = tmp;
+void list<T>::splice(const_iterator pos, list &other, const_iterator it) {
+  NodeBase *node = const_cast<NodeBase *>(it.Get());
+  NodeBase *target = const_cast<NodeBase *>(pos.Get());
+  if (target == node || target == node->next_) return;
+  list_links::splice(target, node, node->next_);
+  ++size_;
+  --other.size_;
 }
 
 template <class T>
-void list<T>::unique() {
-  Node *uni = head_;
-  while (uni != tail_) {
-    while (uni->value_ == uni->next_->value_) {
-      iterator it(uni->next_);
-      erase(it);
-    }
-    uni = uni->next_;
+void list<T>::splice(const_iterator pos, list &other, const_iterator first,
+                     const_iterator last) {
+  size_type count = 0;
+  if (this != &other) {
+    for (const_iterator it = first; it != last; ++it) ++count;
   }
+  splice(pos, other, first, last, count);
 }
 
+// count must be the length of [first, last); it is ignored when other is
+// this list.
 template <class T>
-void list<T>::sort() {
-  if (size_ <= 1) return;
-  tail_->prev_->next_ = nullptr;
-  mergeSort(&head_, size_);
-  Node *tmp = head_;
-  for (size_type i = 0; i < size_ - 1; ++i) tmp = tmp->next_;
-  tmp->next_ = tail_;
-  tail_->next_ = head_;
-  head_->prev_ = tail_;
-  reconnectingPrev();
-}
-
-template <class T>
-void list<T>::reconnectingPrev() {
-  Node *tmp = head_;
-  while (tmp != tail_) {
-    Node *next = tmp->next_;
-    next->prev_ = tmp;
-    tmp = tmp->next_;
-  }
+void list<T>::splice(const_iterator pos, list &other, const_iterator first,
+                     const_iterator last, size_type count) {
+  list_links::splice(const_cast<NodeBase *>(pos.Get()),
+                     const_cast<NodeBase *>(first.Get()),
+                     const_cast<NodeBase *>(last.Get()));
+  if (this == &other) return;
+  size_ += count;
+  other.size_ -= count;
 }
 
 template <class T>
-void list<T>::mergeSort(Node **temp, size_type size) {
-  if (size <= 1) return;
-  Node *left = *temp;
-  Node *tmp = *temp;
-  size_type left_size = size / 2;
-  size_type right_size = size - left_size;
-  for (size_type i = 0; i < left_size; ++i) tmp = tmp->next_;
-  Node *right = tmp;
-  for (size_type i = 0; i < right_size - 1; ++i) tmp = tmp->next_;
-  right->prev_->next_ = nullptr;
-  tmp->next_ = nullptr;
-  mergeSort(&left, left_size);
-  mergeSort(&right, right_size);
-  Node *start = nullptr;
-  if (left->value_ <= right->value_) {
-    start = left;
-    left = left->next_;
-  } else {
-    start = right;
-    right = right->next_;
-  }
-  Node *res = start;
-  while (left != nullptr && right != nullptr) {
-    if (left->value_ <= right->value_) {
-      res->next_ = left;
-      left = left->next_;
-    } else {
-      res->next_ = right;
-      right = right->next_;
-    }
-    res = res->next_;
-  }
-  if (left != nullptr) {
-    res->next_ = left;
-  } else {
-    res->next_ = right;
-  }
-  *temp = start;
+void list<T>::reverse() {
+  list_links::reverse(&sentinel_);
+}
+
+template <class T>
+typename list<T>::size_type list<T>::remove(const_reference value) {
+  return remove_if([&value](const_reference item) { return item == value; });
+}
+
+template <class T>
+template <class Predicate>
+typename list<T>::size_type list<T>::remove_if(Predicate pred) {
+  return eraseNodes(
+      [&pred](const NodeBase *node) { return pred(value(node)); });
 }
 
 template <class T>
-void list<T>::zeroSize() {
-  size_ = 0;
-  tail_->value_ = size_;
-  head_ = tail_;
-  tail_->next_ = tail_;
-  tail_->prev_ = tail_;
+template <class BinaryPredicate>
+typename list<T>::size_type list<T>::unique(BinaryPredicate pred) {
+  const NodeBase *kept = nullptr;
+  return eraseNodes([&pred, &kept](const NodeBase *node) {
+    if (kept && pred(value(kept), value(node))) return true;
+    kept = node;
+    return false;
+  });
+}
+
+template <class T>
+template <class Compare>
+void list<T>::sort(Compare comp, bool parallel) {
+  if (size_ <= 1) return;
+  auto less = [comp](const NodeBase *a, const NodeBase *b) mutable {
+    return comp(value(a), value(b));
+  };
+  int depth = parallel ? parallelDepth() : 0;
+  list_links::sortRing(&sentinel_, size_, less, depth);
 }
 
 template <class T>
 template <typename... Args>
 typename list<T>::ListIterator list<T>::insert_many(const_iterator pos,
                                                     Args &&...args) {
-  if (!sizeof...(args)) return iterator(head_);
+  if (!sizeof...(args)) return begin();
   list<T> tmp{args...};
-  size_ += tmp.size_;
-  Node *left = pos.Get()->prev_;
-  Node *right = left->next_;
-  left->next_ = tmp.head_;
-  tmp.head_->prev_ = left;
-  right->prev_ = tmp.tail_->prev_;
-  tmp.tail_->prev_->next_ = right;
-  tmp.zeroSize();
-  return iterator(head_);
+  splice(pos, tmp);
+  return begin();
 }
 
 template <class T>
@@ -586,12 +781,7 @@ template <typename... Args>
 void list<T>::insert_many_back(Args &&...args) {
   if (!sizeof...(args)) return;
   list<T> tmp{args...};
-  size_ += tmp.size_;
-  tail_->prev_->next_ = tmp.head_;
-  tmp.head_->prev_ = tail_->prev_;
-  tail_->prev_ = tmp.tail_->prev_;
-  tmp.tail_->prev_->next_ = tail_;
-  tmp.zeroSize();
+  splice(cend(), tmp);
 }
 
 template <class T>
@@ -599,15 +789,14 @@ template <typename... Args>
 void list<T>::insert_many_front(Args &&...args) {
   if (!sizeof...(args)) return;
   list<T> tmp{args...};
-  size_ += tmp.size_;
-  tail_->next_ = tmp.head_;
-  tmp.head_->prev_ = tail_;
-  head_->prev_ = tmp.tail_->prev_;
-  tmp.tail_->prev_->next_ = head_;
-  head_ = tmp.head_;
-  tmp.zeroSize();
+  splice(cbegin(), tmp);
+}
+
+template <class T, class Predicate>
+typename list<T>::size_type erase_if(list<T> &l, Predicate pred) {
+  return l.remove_if(pred);
 }
 
 }  // namespace mycontainers
 
-#endif  // MY_CONTAINERS_MY_LIST_H
\ No newline at end of file
+#endif  // MY_CONTAINERS_MY_LIST_H
@@ -0,0 +1,235 @@
+#ifndef MY_CONTAINERS_MY_LIST_LINKS_H
+#define MY_CONTAINERS_MY_LIST_LINKS_H
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <thread>
+
+namespace mycontainers {
+
+// Links of an element in a doubly linked ring. list and intrusive_list
+// close the ring with a sentinel that holds no element and share the
+// algorithms in list_links, some of which open the ring into a
+// null-terminated chain of next_ links.
+struct ListLinks {
+  ListLinks() : next_(this), prev_(this) {}
+  ListLinks(ListLinks *next, ListLinks *prev) : next_(next), prev_(prev) {}
+
+  ListLinks *next_;
+  ListLinks *prev_;
+};
+
+namespace list_links {
+
+// Shortest piece worth handing to another thread in a parallel sort.
+constexpr std::size_t kParallelSortSize = 1 << 15;
+
+inline void linkBefore(ListLinks *pos, ListLinks *node) {
+  node->next_ = pos;
+  node->prev_ = pos->prev_;
+  pos->prev_->next_ = node;
+  pos->prev_ = node;
+}
+
+inline void unlink(ListLinks *node) {
+  node->prev_->next_ = node->next_;
+  node->next_->prev_ = node->prev_;
+}
+
+// Moves every element of the ring closed by other before pos and leaves
+// other empty.
+inline void splice(ListLinks *pos, ListLinks *other) {
+  if (other->next_ == other) return;
+  ListLinks *prev = pos->prev_;
+  prev->next_ = other->next_;
+  other->next_->prev_ = prev;
+  pos->prev_ = other->prev_;
+  other->prev_->next_ = pos;
+  other->next_ = other->prev_ = other;
+}
+
+// Moves the elements [first, last) before pos, which must lie outside the
+// range. The range may belong to another ring.
+inline void splice(ListLinks *pos, ListLinks *first, ListLinks *last) {
+  if (first == last) return;
+  ListLinks *back = last->prev_;
+  first->prev_->next_ = last;
+  last->prev_ = first->prev_;
+  ListLinks *prev = pos->prev_;
+  prev->next_ = first;
+  first->prev_ = prev;
+  back->next_ = pos;
+  pos->prev_ = back;
+}
+
+inline void reverse(ListLinks *sentinel) {
+  ListLinks *node = sentinel;
+  do {
+    ListLinks *next = node->next_;
+    node->next_ = node->prev_;
+    node->prev_ = next;
+    node = next;
+  } while (node != sentinel);
+}
+
+// Opens the ring after its last element and returns the first element of
+// the resulting chain, or nullptr for an empty ring.
+inline ListLinks *detachChain(ListLinks *sentinel) {
+  sentinel->prev_->next_ = nullptr;
+  return sentinel->next_;
+}
+
+// Closes the chain starting at first into the ring and restores the back
+// links.
+inline void attachChain(ListLinks *sentinel, ListLinks *first) {
+  ListLinks *prev = sentinel;
+  for (ListLinks *node = first; node; node = node->next_) {
+    prev->next_ = node;
+    node->prev_ = prev;
+    prev = node;
+  }
+  prev->next_ = sentinel;
+  sentinel->prev_ = prev;
+}
+
+// Relinks next_ from the prev_ links, which the chain algorithms below
+// never change, so the ring gets back its order from before detachChain.
+inline void restoreRing(ListLinks *sentinel) {
+  ListLinks *next = sentinel;
+  for (ListLinks *node = sentinel->prev_; node != sentinel;
+       node = node->prev_) {
+    node->next_ = next;
+    next = node;
+  }
+  sentinel->next_ = next;
+}
+
+// Merges two sorted chains, taking equal elements from left first. less
+// compares the elements behind two links.
+template <class Less>
+ListLinks *mergeChains(ListLinks *left, ListLinks *right, Less &less) {
+  ListLinks *start = nullptr;
+  ListLinks **link = &start;
+  while (left && right) {
+    if (less(right, left)) {
+      *link = right;
+      link = &right->next_;
+      right = right->next_;
+    } else {
+      *link = left;
+      link = &left->next_;
+      left = left->next_;
+    }
+  }
+  *link = left ? left : right;
+  return start;
+}
+
+// Cuts the chain into ascending runs, reversing strictly descending ones,
+// and merges them like a binary counter: bins[i] holds the merge of 2^i
+// runs, so every element takes part in O(log runs) merges.
+template <class Less>
+ListLinks *naturalSort(ListLinks *first, Less &less) {
+  ListLinks *bins[std::numeric_limits<std::size_t>::digits] = {};
+  while (first) {
+    ListLinks *run = first;
+    ListLinks *last = first;
+    first = first->next_;
+    if (first && less(first, last)) {
+      run->next_ = nullptr;
+      do {
+        ListLinks *next = first->next_;
+        first->next_ = run;
+        run = first;
+        first = next;
+      } while (first && less(first, run));
+    } else if (first) {
+      do {
+        last = first;
+        first = first->next_;
+      } while (first && !less(first, last));
+      last->next_ = nullptr;
+    }
+    std::size_t bin = 0;
+    for (; bins[bin]; ++bin) {
+      run = mergeChains(bins[bin], run, less);
+      bins[bin] = nullptr;
+    }
+    bins[bin] = run;
+  }
+  ListLinks *result = nullptr;
+  for (ListLinks *bin : bins) {
+    if (bin) result = result ? mergeChains(bin, result, less) : bin;
+  }
+  return result;
+}
+
+// Sorts the chain of size elements starting at first and returns its new
+// head. Halves of long chains are sorted on separate threads while depth
+// allows.
+template <class Less>
+ListLinks *sortChain(ListLinks *first, std::size_t size, Less less,
+                     int depth) {
+  if (depth <= 0 || size < 2 * kParallelSortSize) {
+    return naturalSort(first, less);
+  }
+  ListLinks *middle = first;
+  for (std::size_t i = 1; i < size / 2; ++i) middle = middle->next_;
+  ListLinks *second = middle->next_;
+  middle->next_ = nullptr;
+  std::exception_ptr error;
+  std::thread worker([&first, &error, size, less, depth] {
+    try {
+      first = sortChain(first, size / 2, less, depth - 1);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  });
+  try {
+    second = sortChain(second, size - size / 2, less, depth - 1);
+  } catch (...) {
+    worker.join();
+    throw;
+  }
+  worker.join();
+  if (error) std::rethrow_exception(error);
+  return mergeChains(first, second, less);
+}
+
+// Sorts the ring of size elements. If less throws, the ring is left as it
+// was.
+template <class Less>
+void sortRing(ListLinks *sentinel, std::size_t size, Less less, int depth) {
+  ListLinks *first = detachChain(sentinel);
+  try {
+    first = sortChain(first, size, less, depth);
+  } catch (...) {
+    restoreRing(sentinel);
+    throw;
+  }
+  attachChain(sentinel, first);
+}
+
+// Merges the sorted ring closed by other into the one closed by sentinel
+// and leaves other empty. If less throws, both rings are left as they were.
+template <class Less>
+void mergeRings(ListLinks *sentinel, ListLinks *other, Less &less) {
+  ListLinks *left = detachChain(sentinel);
+  ListLinks *right = detachChain(other);
+  try {
+    left = mergeChains(left, right, less);
+  } catch (...) {
+    restoreRing(sentinel);
+    restoreRing(other);
+    throw;
+  }
+  attachChain(sentinel, left);
+  attachChain(other, nullptr);
+}
+
+}  // namespace list_links
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_LIST_LINKS_H
@@ -1,6 +1,10 @@
 #ifndef MY_CONTAINERS_MY_MAP_H
 #define MY_CONTAINERS_MY_MAP_H
 
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
 #include "my_tree.h"
 
 namespace mycontainers {
@@ -67,6 +71,12 @@ class MyMap {
   }
 
   void erase(iterator pos) { tree_.erase(pos); }
+  // Erases the elements whose key and value pair satisfies pred in O(n)
+  // and returns their number.
+  template <class Predicate>
+  size_type remove_if(Predicate pred) {
+    return tree_.eraseIf(pred);
+  }
   void swap(MyMap &other) { std::swap(tree_, other.tree_); }
   void merge(MyMap &other) { tree_.merge(other.tree_); }
 
@@ -87,28 +97,27 @@ class MyMap {
 
 template <class Key, class T>
 T &MyMap<Key, T>::at(const Key &key) const {
-  static T value;
-
-  if (tree_.contains(key)) {
-    value = *(tree_.find(key));
-  } else {
+  iterator it = tree_.find(key);
+  if (it == tree_.end()) {
     throw std::out_of_range("mycontainers::MyMap::at");
   }
 
-  return value;
+  return it->second;
 }
 
 template <class Key, class T>
 T &MyMap<Key, T>::operator[](const Key &key) {
-  static T value;
-
-  if (tree_.contains(key)) {
-    value = *(tree_.find(key));
-  } else {
-    value = (tree_.insertToTree(key, T(), false).first)->second;
+  iterator it = tree_.find(key);
+  if (it == tree_.end()) {
+    it = tree_.insertToTree(key, T(), false).first;
   }
 
-  return value;
+  return it->second;
+}
+
+template <class Key, class T, class Predicate>
+typename MyMap<Key, T>::size_type erase_if(MyMap<Key, T> &m, Predicate pred) {
+  return m.remove_if(pred);
 }
 
 }  // namespace mycontainers
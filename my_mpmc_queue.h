@@ -0,0 +1,298 @@
+#ifndef MY_CONTAINERS_MY_MPMC_QUEUE_H
+#define MY_CONTAINERS_MY_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace mycontainers {
+
+// Bounded queue for any number of producer and consumer threads (Vyukov's
+// algorithm). Every slot of a power-of-two ring carries a sequence number
+// that tells whose turn it is: a producer claims the slot at the tail when
+// its sequence equals the tail position, a consumer claims the slot at the
+// head when its sequence is one past it. A claim is a single CAS on the
+// index, so threads never block each other inside the queue.
+//
+// The blocking push and pop spin for a while, then yield for a while, and
+// then either keep yielding (wait_mode::spin) or sleep on a futex until the
+// other side makes room or publishes an element (wait_mode::futex, Linux
+// only; elsewhere it yields).
+template <class T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "a claimed slot must be filled and emptied without throwing");
+
+  struct Cell;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  enum class wait_mode { spin, futex };
+
+  // Rounds capacity up to a power of two, at least 2.
+  explicit mpmc_queue(size_type capacity = kDefaultCapacity,
+                      wait_mode mode = wait_mode::spin);
+  mpmc_queue(const mpmc_queue &q) = delete;
+  mpmc_queue(mpmc_queue &&q) = delete;
+  ~mpmc_queue();
+
+  mpmc_queue &operator=(const mpmc_queue &q) = delete;
+  mpmc_queue &operator=(mpmc_queue &&q) = delete;
+
+  // Approximate while other threads are pushing or popping.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept { return mask_ + 1; }
+  size_type max_size() const noexcept;
+  wait_mode mode() const noexcept { return mode_; }
+
+  // Return false at once when the queue is full or empty.
+  bool try_push(const_reference value) { return tryEmplace(value); }
+  bool try_push(value_type &&value) { return tryEmplace(std::move(value)); }
+  bool try_pop(reference out);
+  // Wait until there is room or an element.
+  void push(const_reference value);
+  void push(value_type &&value);
+  void pop(reference out);
+
+ private:
+  static constexpr size_type kDefaultCapacity = 1024;
+  static constexpr size_type kCacheLine = 64;
+  static constexpr int kSpins = 64;
+  static constexpr int kYields = 16;
+
+  // A waiting thread sleeps until the event counter moves away from the
+  // value it read; the other side bumps the counter and wakes a sleeper
+  // only when waiters is non-zero.
+  struct alignas(kCacheLine) Waiters {
+    std::atomic<std::uint32_t> event{0};
+    std::atomic<std::uint32_t> waiters{0};
+  };
+
+  template <class Value>
+  bool tryEmplace(Value &&value);
+  template <class TryFunction>
+  void waitUntil(TryFunction attempt, Waiters &waiters);
+  void notify(Waiters &waiters);
+  static void futexWait(std::atomic<std::uint32_t> &word,
+                        std::uint32_t expected);
+  static void futexWake(std::atomic<std::uint32_t> &word);
+
+  // Read-only after construction.
+  Cell *cells_;
+  size_type mask_;
+  wait_mode mode_;
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};
+  alignas(kCacheLine) std::atomic<size_type> head_{0};
+  // Consumers wait here for an element, producers for room.
+  Waiters notEmpty_;
+  Waiters notFull_;
+};  // class mpmc_queue
+
+template <class T>
+struct mpmc_queue<T>::Cell {
+  T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+
+  std::atomic<size_type> sequence;
+  alignas(T) unsigned char storage[sizeof(T)];
+};
+
+template <class T>
+mpmc_queue<T>::mpmc_queue(size_type capacity, wait_mode mode) : mode_(mode) {
+  if (capacity > max_size()) {
+    throw std::length_error("mycontainers::mpmc_queue");
+  }
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  cells_ = std::allocator<Cell>().allocate(rounded);
+  mask_ = rounded - 1;
+  for (size_type i = 0; i < rounded; ++i) {
+    new (&cells_[i].sequence) std::atomic<size_type>(i);
+  }
+}
+
+template <class T>
+mpmc_queue<T>::~mpmc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    cells_[i & mask_].value()->~T();
+  }
+  std::allocator<Cell>().deallocate(cells_, mask_ + 1);
+}
+
+// The head is loaded first, so the tail read after it is never behind.
+template <class T>
+size_t mpmc_queue<T>::size() const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type size = tail_.load(std::memory_order_acquire) - head;
+  return size < capacity() ? size : capacity();
+}
+
+template <class T>
+size_t mpmc_queue<T>::max_size() const noexcept {
+  size_type limit = std::numeric_limits<size_type>::max() / 2 / sizeof(Cell);
+  size_type power = 1;
+  while (power <= limit / 2) power *= 2;
+  return power;
+}
+
+template <class T>
+bool mpmc_queue<T>::try_pop(reference out) {
+  size_type pos = head_.load(std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = std::ptrdiff_t(sequence - (pos + 1));
+    if (diff == 0) {
+      if (head_.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = head_.load(std::memory_order_relaxed);
+    }
+  }
+  out = std::move(*cell->value());
+  cell->value()->~T();
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  notify(notFull_);
+  return true;
+}
+
+template <class T>
+void mpmc_queue<T>::push(const_reference value) {
+  if (try_push(value)) return;
+  waitUntil([&] { return try_push(value); }, notFull_);
+}
+
+template <class T>
+void mpmc_queue<T>::push(value_type &&value) {
+  if (try_push(std::move(value))) return;
+  waitUntil([&] { return try_push(std::move(value)); }, notFull_);
+}
+
+template <class T>
+void mpmc_queue<T>::pop(reference out) {
+  if (try_pop(out)) return;
+  waitUntil([&] { return try_pop(out); }, notEmpty_);
+}
+
+// A claimed slot must be filled, so a value that may throw while being
+// copied in is copied before the claim.
+template <class T>
+template <class Value>
+bool mpmc_queue<T>::tryEmplace(Value &&value) {
+  if constexpr (!std::is_nothrow_constructible_v<T, Value &&>) {
+    if (size() == capacity()) return false;
+    T copy(std::forward<Value>(value));
+    return tryEmplace(std::move(copy));
+  } else {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = std::ptrdiff_t(sequence - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) T(std::forward<Value>(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    notify(notEmpty_);
+    return true;
+  }
+}
+
+// The waiter registers before its last attempt and the notifier checks for
+// waiters after publishing, both behind a full fence, so either the attempt
+// sees the change or the notifier sees the waiter; the event read before
+// registering makes a wake-up that slips in before the sleep return at once.
+template <class T>
+template <class TryFunction>
+void mpmc_queue<T>::waitUntil(TryFunction attempt, Waiters &waiters) {
+  for (int spin = 0;; ++spin) {
+    if (spin < kSpins) {
+      if (attempt()) return;
+      continue;
+    }
+    if (mode_ == wait_mode::spin || spin < kSpins + kYields) {
+      std::this_thread::yield();
+      if (attempt()) return;
+      continue;
+    }
+    std::uint32_t event = waiters.event.load(std::memory_order_acquire);
+    waiters.waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool done = attempt();
+    if (!done) futexWait(waiters.event, event);
+    waiters.waiters.fetch_sub(1, std::memory_order_relaxed);
+    if (done || attempt()) return;
+  }
+}
+
+template <class T>
+void mpmc_queue<T>::notify(Waiters &waiters) {
+  if (mode_ == wait_mode::spin) return;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!waiters.waiters.load(std::memory_order_relaxed)) return;
+  waiters.event.fetch_add(1, std::memory_order_release);
+  futexWake(waiters.event);
+}
+
+template <class T>
+void mpmc_queue<T>::futexWait(std::atomic<std::uint32_t> &word,
+                              std::uint32_t expected) {
+#ifdef __linux__
+  static_assert(sizeof(word) == sizeof(std::uint32_t) &&
+                std::atomic<std::uint32_t>::is_always_lock_free);
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word),
+          FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+  (void)word;
+  (void)expected;
+  std::this_thread::yield();
+#endif
+}
+
+template <class T>
+void mpmc_queue<T>::futexWake(std::atomic<std::uint32_t> &word) {
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word),
+          FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_MPMC_QUEUE_H
@@ -1,6 +1,9 @@
 #ifndef MY_CONTAINERS_MY_MULTISET_H
 #define MY_CONTAINERS_MY_MULTISET_H
 
+#include <initializer_list>
+#include <utility>
+
 #include "my_tree.h"
 
 namespace mycontainers {
@@ -49,9 +52,34 @@ class MyMultiset {
     return (tree_.insertToTree(value, value, true)).first;
   }
   void erase(iterator pos) { tree_.erase(pos); }
+  // Erases the elements satisfying pred in O(n) and returns their number.
+  template <class Predicate>
+  size_type remove_if(Predicate pred) {
+    return tree_.eraseIf(
+        [&pred](const auto &item) { return pred(item.first); });
+  }
   void swap(MyMultiset &other) { std::swap(tree_, other.tree_); }
   void merge(MyMultiset &other) { tree_.merge(other.tree_, true); }
 
+  // Set algebra in O(m log(n / m + 1)); other is consumed and left empty.
+  // With other being *this, only set_difference changes it (to empty).
+  void set_union(MyMultiset &other, bool parallel = false) {
+    tree_.setUnion(other.tree_, true, parallel);
+  }
+  void set_intersection(MyMultiset &other, bool parallel = false) {
+    tree_.setIntersection(other.tree_, true, parallel);
+  }
+  void set_difference(MyMultiset &other, bool parallel = false) {
+    tree_.setDifference(other.tree_, true, parallel);
+  }
+  // Moves the elements not less than key into the returned container in
+  // O(log n + min(k, n - k) + e), where k elements stay and e equal key.
+  MyMultiset split(const key_type &key) {
+    MyMultiset greater;
+    greater.tree_ = tree_.split(key, true);
+    return greater;
+  }
+
   iterator find(const key_type &key) const noexcept { return tree_.find(key); }
 
   bool contains(const key_type &key) const noexcept {
@@ -76,6 +104,12 @@ class MyMultiset {
   BinaryTree<key_type, value_type> tree_;
 };  // class MyMultiset
 
+template <class Key, class Predicate>
+typename MyMultiset<Key>::size_type erase_if(MyMultiset<Key> &s,
+                                            Predicate pred) {
+  return s.remove_if(pred);
+}
+
 }  // namespace mycontainers
 
 #endif  // MY_CONTAINERS_MY_MULTISET_H
@@ -0,0 +1,21 @@
+#ifndef MY_CONTAINERS_MY_PARALLEL_H
+#define MY_CONTAINERS_MY_PARALLEL_H
+
+#include <thread>
+
+namespace mycontainers {
+
+// Recursion depth down to which the parallel sorts and set operations of
+// list, intrusive_list and BinaryTree hand one half to a new thread: one
+// level more than needed to occupy every core, as the halves are rarely
+// equal.
+inline int parallelDepth() {
+  unsigned threads = std::thread::hardware_concurrency();
+  int depth = 1;
+  while ((1u << (depth - 1)) < threads) ++depth;
+  return depth;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_PARALLEL_H
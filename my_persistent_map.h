@@ -0,0 +1,472 @@
+#ifndef MY_CONTAINERS_MY_PERSISTENT_MAP_H
+#define MY_CONTAINERS_MY_PERSISTENT_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace mycontainers {
+
+// Immutable AVL tree with structural sharing. Every update copies only the
+// path from the root to the changed node and shares all other subtrees
+// with the previous version, so copying the map or taking a snapshot() is
+// O(1). Nodes are never modified after construction and are reference
+// counted atomically, so snapshots may be read from other threads while
+// the original map keeps changing.
+template <class Key, class T>
+class persistent_map {
+  class Node;
+  class PersistentMapIterator;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = PersistentMapIterator;
+  using const_iterator = PersistentMapIterator;
+  using size_type = size_t;
+
+  persistent_map() = default;
+  persistent_map(std::initializer_list<value_type> const &items);
+  persistent_map(const persistent_map &m)
+      : root_(acquire(m.root_)), size_(m.size_) {}
+  persistent_map(persistent_map &&m) noexcept { swap(m); }
+  ~persistent_map() { release(root_); }
+
+  persistent_map &operator=(const persistent_map &m);
+  persistent_map &operator=(persistent_map &&m) noexcept;
+
+  persistent_map snapshot() const { return *this; }
+
+  const mapped_type &at(const key_type &key) const;
+
+  iterator begin() const;
+  iterator end() const { return iterator(root_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos) {
+    if (pos != end()) erase(pos->first);
+  }
+  size_type erase(const key_type &key);
+  void swap(persistent_map &other) noexcept;
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+
+ private:
+  static const Node *acquire(const Node *node);
+  static void release(const Node *node);
+  static int height(const Node *node) { return node ? node->height_ : 0; }
+  static const Node *makeNode(const value_type &value, const Node *left,
+                              const Node *right);
+  static const Node *balance(const value_type &value, const Node *left,
+                             const Node *right);
+  static const Node *insertNode(const Node *node, const key_type &key,
+                                const mapped_type &obj);
+  static const Node *eraseNode(const Node *node, const key_type &key);
+  static const Node *eraseMin(const Node *node);
+  const Node *findNode(const key_type &key) const;
+
+  const Node *root_ = nullptr;
+  size_type size_ = 0;
+};
+
+template <class Key, class T>
+class persistent_map<Key, T>::Node {
+ public:
+  Node(const value_type &value, const Node *left, const Node *right)
+      : left_(left),
+        right_(right),
+        height_(1 + std::max(height(left), height(right))),
+        value_(value) {}
+
+  mutable std::atomic<size_type> refs_{1};
+  const Node *left_;
+  const Node *right_;
+  int height_;
+  value_type value_;
+};  // class Node
+
+// Keeps the whole path from the root to the current node, so moving in both
+// directions needs no parent links (which shared nodes cannot have).
+template <class Key, class T>
+class persistent_map<Key, T>::PersistentMapIterator {
+ public:
+  PersistentMapIterator() = default;
+  explicit PersistentMapIterator(const Node *root) : root_(root) {}
+  PersistentMapIterator(const PersistentMapIterator &other);
+  PersistentMapIterator &operator=(const PersistentMapIterator &other);
+
+  const_reference operator*() const { return path_[depth_ - 1]->value_; }
+  const value_type *operator->() const { return &path_[depth_ - 1]->value_; }
+
+  bool operator==(const PersistentMapIterator &it) const {
+    return get() == it.get();
+  }
+  bool operator!=(const PersistentMapIterator &it) const {
+    return get() != it.get();
+  }
+
+  PersistentMapIterator operator++();
+  PersistentMapIterator operator--();
+
+ private:
+  friend class persistent_map;
+  // An AVL tree of height 64 would hold far more nodes than fit in memory.
+  static constexpr int kMaxDepth = 64;
+
+  const Node *get() const { return depth_ ? path_[depth_ - 1] : nullptr; }
+  void push(const Node *node) { path_[depth_++] = node; }
+  void pushLeftmost(const Node *node);
+  void pushRightmost(const Node *node);
+
+  const Node *root_ = nullptr;
+  int depth_ = 0;
+  const Node *path_[kMaxDepth];
+};  // class PersistentMapIterator
+
+template <class Key, class T>
+persistent_map<Key, T>::PersistentMapIterator::PersistentMapIterator(
+    const PersistentMapIterator &other)
+    : root_(other.root_), depth_(other.depth_) {
+  for (int i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+}
+
+template <class Key, class T>
+typename persistent_map<Key, T>::PersistentMapIterator &
+persistent_map<Key, T>::PersistentMapIterator::operator=(
+    const PersistentMapIterator &other) {
+  root_ = other.root_;
+  depth_ = other.depth_;
+  for (int i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+  return *this;
+}
+
+template <class Key, class T>
+void persistent_map<Key, T>::PersistentMapIterator::pushLeftmost(
+    const Node *node) {
+  for (; node; node = node->left_) push(node);
+}
+
+template <class Key, class T>
+void persistent_map<Key, T>::PersistentMapIterator::pushRightmost(
+    const Node *node) {
+  for (; node; node = node->right_) push(node);
+}
+
+template <class Key, class T>
+typename persistent_map<Key, T>::PersistentMapIterator
+persistent_map<Key, T>::PersistentMapIterator::operator++() {
+  if (!depth_) return *this;
+  const Node *node = path_[depth_ - 1];
+  if (node->right_) {
+    pushLeftmost(node->right_);
+  } else {
+    --depth_;
+    while (depth_ && path_[depth_ - 1]->right_ == node) {
+      node = path_[--depth_];
+    }
+  }
+  return *this;
+}
+
+template <class Key, class T>
+typename persistent_map<Key, T>::PersistentMapIterator
+persistent_map<Key, T>::PersistentMapIterator::operator--() {
+  if (!depth_) {
+    pushRightmost(root_);
+    return *this;
+  }
+  const Node *node = path_[depth_ - 1];
+  if (node->left_) {
+    pushRightmost(node->left_);
+  } else {
+    --depth_;
+    while (depth_ && path_[depth_ - 1]->left_ == node) {
+      node = path_[--depth_];
+    }
+  }
+  return *this;
+}
+
+template <class Key, class T>
+persistent_map<Key, T>::persistent_map(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) {
+    insert(item.first, item.second);
+  }
+}
+
+template <class Key, class T>
+persistent_map<Key, T> &persistent_map<Key, T>::operator=(
+    const persistent_map &m) {
+  persistent_map tmp(m);
+  swap(tmp);
+  return *this;
+}
+
+template <class Key, class T>
+persistent_map<Key, T> &persistent_map<Key, T>::operator=(
+    persistent_map &&m) noexcept {
+  swap(m);
+  return *this;
+}
+
+template <class Key, class T>
+const T &persistent_map<Key, T>::at(const key_type &key) const {
+  const Node *node = findNode(key);
+  if (!node) {
+    throw std::out_of_range("mycontainers::persistent_map::at");
+  }
+  return node->value_.second;
+}
+
+template <class Key, class T>
+typename persistent_map<Key, T>::iterator persistent_map<Key, T>::begin()
+    const {
+  iterator it(root_);
+  it.pushLeftmost(root_);
+  return it;
+}
+
+template <class Key, class T>
+size_t persistent_map<Key, T>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(Node);
+}
+
+template <class Key, class T>
+void persistent_map<Key, T>::clear() {
+  release(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <class Key, class T>
+std::pair<typename persistent_map<Key, T>::iterator, bool>
+persistent_map<Key, T>::insert(const key_type &key, const mapped_type &obj) {
+  if (contains(key)) return std::pair<iterator, bool>(find(key), false);
+  const Node *root = insertNode(root_, key, obj);
+  release(root_);
+  root_ = root;
+  ++size_;
+  return std::pair<iterator, bool>(find(key), true);
+}
+
+template <class Key, class T>
+std::pair<typename persistent_map<Key, T>::iterator, bool>
+persistent_map<Key, T>::insert_or_assign(const key_type &key,
+                                         const mapped_type &obj) {
+  bool inserted = !contains(key);
+  const Node *root = insertNode(root_, key, obj);
+  release(root_);
+  root_ = root;
+  if (inserted) ++size_;
+  return std::pair<iterator, bool>(find(key), inserted);
+}
+
+template <class Key, class T>
+size_t persistent_map<Key, T>::erase(const key_type &key) {
+  if (!contains(key)) return 0;
+  const Node *root = eraseNode(root_, key);
+  release(root_);
+  root_ = root;
+  --size_;
+  return 1;
+}
+
+template <class Key, class T>
+void persistent_map<Key, T>::swap(persistent_map &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+template <class Key, class T>
+typename persistent_map<Key, T>::iterator persistent_map<Key, T>::find(
+    const key_type &key) const {
+  iterator it(root_);
+  const Node *node = root_;
+  while (node) {
+    it.push(node);
+    if (key < node->value_.first) {
+      node = node->left_;
+    } else if (node->value_.first < key) {
+      node = node->right_;
+    } else {
+      return it;
+    }
+  }
+  return end();
+}
+
+template <class Key, class T>
+bool persistent_map<Key, T>::contains(const key_type &key) const {
+  return findNode(key) != nullptr;
+}
+
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::acquire(
+    const Node *node) {
+  if (node) node->refs_.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+template <class Key, class T>
+void persistent_map<Key, T>::release(const Node *node) {
+  while (node && node->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    release(node->left_);
+    const Node *right = node->right_;
+    delete node;
+    node = right;
+  }
+}
+
+// Takes over the references to left and right held by the caller.
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::makeNode(
+    const value_type &value, const Node *left, const Node *right) {
+  try {
+    return new Node(value, left, right);
+  } catch (...) {
+    release(left);
+    release(right);
+    throw;
+  }
+}
+
+// Builds a node from value and the owned subtrees, rotating when their
+// heights differ by more than one. The child taking over the lighter
+// subtree is built first and kept in outer until the node above takes it,
+// so that a failed allocation releases every reference held so far.
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::balance(
+    const value_type &value, const Node *left, const Node *right) {
+  const Node *result = nullptr;
+  const Node *outer = nullptr;
+  if (height(left) > height(right) + 1) {
+    try {
+      const Node *pivot = left->right_;
+      if (height(left->left_) >= height(pivot)) {
+        outer = makeNode(value, acquire(pivot), right);
+        result = makeNode(left->value_, acquire(left->left_),
+                          std::exchange(outer, nullptr));
+      } else {
+        outer = makeNode(value, acquire(pivot->right_), right);
+        const Node *inner = makeNode(left->value_, acquire(left->left_),
+                                     acquire(pivot->left_));
+        result = makeNode(pivot->value_, inner, std::exchange(outer, nullptr));
+      }
+    } catch (...) {
+      release(outer);
+      release(left);
+      throw;
+    }
+    release(left);
+  } else if (height(right) > height(left) + 1) {
+    try {
+      const Node *pivot = right->left_;
+      if (height(right->right_) >= height(pivot)) {
+        outer = makeNode(value, left, acquire(pivot));
+        result = makeNode(right->value_, std::exchange(outer, nullptr),
+                          acquire(right->right_));
+      } else {
+        outer = makeNode(value, left, acquire(pivot->left_));
+        const Node *inner = makeNode(right->value_, acquire(pivot->right_),
+                                     acquire(right->right_));
+        result = makeNode(pivot->value_, std::exchange(outer, nullptr), inner);
+      }
+    } catch (...) {
+      release(outer);
+      release(right);
+      throw;
+    }
+    release(right);
+  } else {
+    result = makeNode(value, left, right);
+  }
+  return result;
+}
+
+// The rebuilt child is computed before the sibling is acquired: argument
+// evaluation order is unspecified, and a throw from the recursion must not
+// leave an acquired reference behind.
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *
+persistent_map<Key, T>::insertNode(const Node *node, const key_type &key,
+                                   const mapped_type &obj) {
+  if (!node) return makeNode(value_type(key, obj), nullptr, nullptr);
+
+  if (key < node->value_.first) {
+    const Node *left = insertNode(node->left_, key, obj);
+    return balance(node->value_, left, acquire(node->right_));
+  }
+  if (node->value_.first < key) {
+    const Node *right = insertNode(node->right_, key, obj);
+    return balance(node->value_, acquire(node->left_), right);
+  }
+  value_type value(key, obj);
+  return makeNode(value, acquire(node->left_), acquire(node->right_));
+}
+
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::eraseNode(
+    const Node *node, const key_type &key) {
+  if (key < node->value_.first) {
+    const Node *left = eraseNode(node->left_, key);
+    return balance(node->value_, left, acquire(node->right_));
+  }
+  if (node->value_.first < key) {
+    const Node *right = eraseNode(node->right_, key);
+    return balance(node->value_, acquire(node->left_), right);
+  }
+  if (!node->left_) return acquire(node->right_);
+  if (!node->right_) return acquire(node->left_);
+
+  const Node *min = node->right_;
+  while (min->left_) min = min->left_;
+  const Node *right = eraseMin(node->right_);
+  return balance(min->value_, acquire(node->left_), right);
+}
+
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::eraseMin(
+    const Node *node) {
+  if (!node->left_) return acquire(node->right_);
+  const Node *left = eraseMin(node->left_);
+  return balance(node->value_, left, acquire(node->right_));
+}
+
+template <class Key, class T>
+const typename persistent_map<Key, T>::Node *persistent_map<Key, T>::findNode(
+    const key_type &key) const {
+  const Node *node = root_;
+  while (node) {
+    if (key < node->value_.first) {
+      node = node->left_;
+    } else if (node->value_.first < key) {
+      node = node->right_;
+    } else {
+      break;
+    }
+  }
+  return node;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_PERSISTENT_MAP_H
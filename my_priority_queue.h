@@ -0,0 +1,183 @@
+#ifndef MY_CONTAINERS_MY_PRIORITY_QUEUE_H
+#define MY_CONTAINERS_MY_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "my_iterator.h"
+#include "my_vector.h"
+
+namespace mycontainers {
+
+// Priority queue over a D-ary max-heap stored in a vector: top() is the
+// greatest element by Compare. A node's children are D consecutive slots,
+// so with the default D = 4 a sift-down step compares children sharing a
+// cache line, and the tree is half as deep as a binary heap.
+template <class T, class Compare = std::less<T>, size_t D = 4>
+class priority_queue {
+  static_assert(D >= 2, "a heap node needs at least two children");
+
+ public:
+  using container_type = mycontainers::vector<T>;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static constexpr size_type arity = D;
+
+  priority_queue() : c_(), comp_() {}
+  explicit priority_queue(const Compare &comp) : c_(), comp_(comp) {}
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare());
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  priority_queue(InputIt first, InputIt last, const Compare &comp = Compare());
+  priority_queue(const priority_queue &q) = default;
+  priority_queue(priority_queue &&q) = default;
+  ~priority_queue() = default;
+
+  priority_queue &operator=(const priority_queue &q) = default;
+  priority_queue &operator=(priority_queue &&q) = default;
+
+  const_reference top() const { return c_.front(); }
+
+  bool empty() const noexcept { return c_.empty(); }
+  size_type size() const noexcept { return c_.size(); }
+  void reserve(size_type n) { c_.reserve(n); }
+
+  void push(const_reference value);
+  void push(value_type &&value);
+  template <class... Args>
+  void emplace(Args &&...args) {
+    push(value_type(std::forward<Args>(args)...));
+  }
+  // Appends [first, last) and restores the heap either by sifting up each
+  // new element or by rebuilding the whole heap in O(n), whichever is
+  // cheaper.
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last);
+  void pop();
+  void swap(priority_queue &other);
+
+ private:
+  void siftUp(size_type hole);
+  void siftDown(size_type hole);
+  void heapify();
+
+  container_type c_;
+  Compare comp_;
+};  // class priority_queue
+
+template <class T, class Compare, size_t D>
+priority_queue<T, Compare, D>::priority_queue(
+    std::initializer_list<value_type> const &items, const Compare &comp)
+    : c_(), comp_(comp) {
+  push_range(items.begin(), items.end());
+}
+
+template <class T, class Compare, size_t D>
+template <class InputIt, class>
+priority_queue<T, Compare, D>::priority_queue(InputIt first, InputIt last,
+                                              const Compare &comp)
+    : c_(), comp_(comp) {
+  push_range(first, last);
+}
+
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::push(const_reference value) {
+  c_.push_back(value);
+  siftUp(c_.size() - 1);
+}
+
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::push(value_type &&value) {
+  c_.push_back(std::move(value));
+  siftUp(c_.size() - 1);
+}
+
+template <class T, class Compare, size_t D>
+template <class InputIt>
+void priority_queue<T, Compare, D>::push_range(InputIt first, InputIt last) {
+  size_type old = c_.size();
+  if constexpr (is_forward_iterator_v<InputIt>) {
+    c_.reserve(old + std::distance(first, last));
+  }
+  for (; first != last; ++first) c_.push_back(*first);
+  size_type size = c_.size();
+  size_type depth = 0;
+  for (size_type level = 1; level < size; level *= D) ++depth;
+  if ((size - old) * depth > size) {
+    heapify();
+  } else {
+    for (size_type i = old; i < size; ++i) siftUp(i);
+  }
+}
+
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::pop() {
+  size_type size = c_.size();
+  if (!size) return;
+  T *data = c_.data();
+  if (size > 1) data[0] = std::move(data[size - 1]);
+  c_.pop_back();
+  if (size > 2) siftDown(0);
+}
+
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::swap(priority_queue &other) {
+  c_.swap(other.c_);
+  std::swap(comp_, other.comp_);
+}
+
+// Moves parents down into the hole until the element fits, then drops the
+// element in once instead of swapping it level by level.
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::siftUp(size_type hole) {
+  T *data = c_.data();
+  T value = std::move(data[hole]);
+  while (hole > 0) {
+    size_type parent = (hole - 1) / D;
+    if (!comp_(data[parent], value)) break;
+    data[hole] = std::move(data[parent]);
+    hole = parent;
+  }
+  data[hole] = std::move(value);
+}
+
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::siftDown(size_type hole) {
+  T *data = c_.data();
+  size_type size = c_.size();
+  T value = std::move(data[hole]);
+  for (;;) {
+    size_type first = hole * D + 1;
+    if (first >= size) break;
+    size_type last = size - first > D ? first + D : size;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp_(data[best], data[child])) best = child;
+    }
+    if (!comp_(value, data[best])) break;
+    data[hole] = std::move(data[best]);
+    hole = best;
+  }
+  data[hole] = std::move(value);
+}
+
+// Floyd's construction: sifts down every parent, last to first, in O(n).
+template <class T, class Compare, size_t D>
+void priority_queue<T, Compare, D>::heapify() {
+  size_type size = c_.size();
+  if (size < 2) return;
+  for (size_type parent = (size - 2) / D + 1; parent-- > 0;) siftDown(parent);
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_PRIORITY_QUEUE_H
@@ -1,13 +1,26 @@
 #ifndef MY_CONTAINERS_MY_QUEUE_H
 #define MY_CONTAINERS_MY_QUEUE_H
 
-#include "my_list.h"
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "my_iterator.h"
+#include "my_ring_buffer.h"
 
 namespace mycontainers {
 
-template <class T>
+// Adapter over Container, which needs front, back, push_back, pop_front,
+// empty and size, plus insert_many_back if that member is used. The default
+// ring_buffer allocates only when the buffer doubles; list or any other
+// type with these members may be used instead.
+template <class T, class Container = mycontainers::ring_buffer<T>>
 class MyQueue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -15,6 +28,8 @@ class MyQueue {
 
   MyQueue() : c_() {}
   MyQueue(std::initializer_list<value_type> const &items) : c_(items) {}
+  explicit MyQueue(const Container &c) : c_(c) {}
+  explicit MyQueue(Container &&c) : c_(std::move(c)) {}
   MyQueue(const MyQueue &s) : c_(s.c_) {}
   MyQueue(MyQueue &&s) noexcept : c_(std::move(s.c_)) {}
   ~MyQueue() {}
@@ -32,7 +47,9 @@ class MyQueue {
     return *this;
   }
 
+  reference front() { return c_.front(); }
   const_reference front() const { return c_.front(); }
+  reference back() { return c_.back(); }
   const_reference back() const { return c_.back(); }
 
   bool empty() const noexcept { return c_.empty(); }
@@ -44,13 +61,53 @@ class MyQueue {
   }
   void swap(MyQueue &other) { std::swap(c_, other.c_); }
 
+  // Move the front element out instead of copying it before pop().
+  value_type pop_value() {
+    if (c_.empty()) throw std::out_of_range("mycontainers::MyQueue::pop_value");
+    value_type value(std::move(c_.front()));
+    c_.pop_front();
+    return value;
+  }
+  std::optional<value_type> try_pop() {
+    if (c_.empty()) return std::nullopt;
+    std::optional<value_type> value(std::move(c_.front()));
+    c_.pop_front();
+    return value;
+  }
+  // Moves up to n elements, front first, to out and returns their number.
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type popped = 0;
+    for (; popped < n && !c_.empty(); ++popped, ++out) {
+      *out = std::move(c_.front());
+      c_.pop_front();
+    }
+    return popped;
+  }
+  // Pushes [first, last) in order; the container grows at most once when
+  // the range length is known.
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    if constexpr (is_forward_iterator_v<InputIt>) {
+      reserve(c_, c_.size() + std::distance(first, last), 0);
+    }
+    for (; first != last; ++first) c_.push_back(*first);
+  }
+
   template <class... Args>
   void insert_many_back(Args &&...args) {
     c_.insert_many_back(args...);
   }
 
  private:
-  mycontainers::list<value_type> c_;
+  template <class C>
+  static auto reserve(C &c, size_type n, int) -> decltype(c.reserve(n)) {
+    return c.reserve(n);
+  }
+  template <class C>
+  static void reserve(C &, size_type, long) {}
+
+  Container c_;
 };
 
 }  // namespace mycontainers
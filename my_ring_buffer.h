@@ -0,0 +1,291 @@
+#ifndef MY_CONTAINERS_MY_RING_BUFFER_H
+#define MY_CONTAINERS_MY_RING_BUFFER_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mycontainers {
+
+// Growable circular buffer. The elements occupy capacity() contiguous
+// slots starting at head_ and wrapping around; the capacity is a power of
+// two, so a position is mapped to its slot with a mask. Pushing and
+// popping at either end is O(1) amortized and allocates only when the
+// buffer doubles.
+template <class T>
+class ring_buffer {
+ public:
+  class RingBufferConstIterator;
+  class RingBufferIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = RingBufferIterator;
+  using const_iterator = RingBufferConstIterator;
+  using size_type = size_t;
+
+  ring_buffer() = default;
+  ring_buffer(std::initializer_list<value_type> const &items);
+  ring_buffer(const ring_buffer &r);
+  ring_buffer(ring_buffer &&r) noexcept { swap(r); }
+  ~ring_buffer();
+
+  ring_buffer &operator=(const ring_buffer &r);
+  ring_buffer &operator=(ring_buffer &&r) noexcept;
+
+  reference at(size_type pos);
+  reference operator[](size_type pos) { return *slot(pos); }
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+  reference front() { return *slot(0); }
+  const_reference front() const { return *slot(0); }
+  reference back() { return *slot(size_ - 1); }
+  const_reference back() const { return *slot(size_ - 1); }
+
+  iterator begin() const { return iterator(this, 0); }
+  iterator end() const { return iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept { return capacity_; }
+  // Rounds n up to a power of two.
+  void reserve(size_type n);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_front(const_reference value);
+  void pop_back();
+  void pop_front();
+  void swap(ring_buffer &other) noexcept;
+
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  T *slot(size_type pos) const {
+    return data_ + ((head_ + pos) & (capacity_ - 1));
+  }
+  void grow() { reallocate(capacity_ ? capacity_ * 2 : kMinCapacity); }
+  void reallocate(size_type capacity);
+
+  T *data_ = nullptr;
+  size_type capacity_ = 0;
+  size_type head_ = 0;
+  size_type size_ = 0;
+};  // class ring_buffer
+
+template <class T>
+class ring_buffer<T>::RingBufferConstIterator {
+ public:
+  RingBufferConstIterator() = default;
+  RingBufferConstIterator(const ring_buffer *buffer, size_type pos)
+      : buffer_(buffer), pos_(pos) {}
+
+  const T &operator*() const { return *buffer_->slot(pos_); }
+  RingBufferConstIterator operator++() {
+    ++pos_;
+    return *this;
+  }
+  RingBufferConstIterator operator--() {
+    --pos_;
+    return *this;
+  }
+  bool operator==(const RingBufferConstIterator it) const {
+    return pos_ == it.pos_ && buffer_ == it.buffer_;
+  }
+  bool operator!=(const RingBufferConstIterator it) const {
+    return !(*this == it);
+  }
+  size_type operator-(const RingBufferConstIterator it) const {
+    return pos_ - it.pos_;
+  }
+
+ protected:
+  const ring_buffer *buffer_ = nullptr;
+  size_type pos_ = 0;
+};  // class RingBufferConstIterator
+
+template <class T>
+class ring_buffer<T>::RingBufferIterator : public RingBufferConstIterator {
+ public:
+  using RingBufferConstIterator::RingBufferConstIterator;
+
+  T &operator*() const { return *this->buffer_->slot(this->pos_); }
+  RingBufferIterator operator++() {
+    ++this->pos_;
+    return *this;
+  }
+  RingBufferIterator operator--() {
+    --this->pos_;
+    return *this;
+  }
+};  // class RingBufferIterator
+
+template <class T>
+ring_buffer<T>::ring_buffer(std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <class T>
+ring_buffer<T>::ring_buffer(const ring_buffer &r) {
+  reserve(r.size_);
+  for (size_type i = 0; i < r.size_; ++i) push_back(r[i]);
+}
+
+template <class T>
+ring_buffer<T>::~ring_buffer() {
+  clear();
+  if (data_) std::allocator<T>().deallocate(data_, capacity_);
+}
+
+template <class T>
+ring_buffer<T> &ring_buffer<T>::operator=(const ring_buffer &r) {
+  if (this == &r) return *this;
+  ring_buffer tmp(r);
+  swap(tmp);
+  return *this;
+}
+
+template <class T>
+ring_buffer<T> &ring_buffer<T>::operator=(ring_buffer &&r) noexcept {
+  if (this == &r) return *this;
+  clear();
+  swap(r);
+  return *this;
+}
+
+template <class T>
+T &ring_buffer<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("mycontainers::ring_buffer::at");
+  }
+  return *slot(pos);
+}
+
+template <class T>
+size_t ring_buffer<T>::max_size() const noexcept {
+  size_type limit = std::numeric_limits<size_type>::max() / 2 / sizeof(T);
+  size_type power = 1;
+  while (power <= limit / 2) power *= 2;
+  return power;
+}
+
+template <class T>
+void ring_buffer<T>::reserve(size_type n) {
+  if (n <= capacity_) return;
+  if (n > max_size()) {
+    throw std::length_error("mycontainers::ring_buffer::reserve");
+  }
+  size_type capacity = kMinCapacity;
+  while (capacity < n) capacity *= 2;
+  reallocate(capacity);
+}
+
+template <class T>
+void ring_buffer<T>::shrink_to_fit() {
+  size_type capacity = size_ ? kMinCapacity : 0;
+  while (capacity < size_) capacity *= 2;
+  if (capacity < capacity_) reallocate(capacity);
+}
+
+template <class T>
+void ring_buffer<T>::clear() noexcept {
+  for (size_type i = 0; i < size_; ++i) slot(i)->~T();
+  head_ = 0;
+  size_ = 0;
+}
+
+// The value is copied before the buffer grows, as it may be one of the
+// elements being moved.
+template <class T>
+void ring_buffer<T>::push_back(const_reference value) {
+  if (size_ == capacity_) {
+    T copy(value);
+    grow();
+    new (slot(size_)) T(std::move(copy));
+  } else {
+    new (slot(size_)) T(value);
+  }
+  ++size_;
+}
+
+template <class T>
+void ring_buffer<T>::push_front(const_reference value) {
+  if (size_ == capacity_) {
+    T copy(value);
+    grow();
+    new (slot(capacity_ - 1)) T(std::move(copy));
+  } else {
+    new (slot(capacity_ - 1)) T(value);
+  }
+  head_ = (head_ - 1) & (capacity_ - 1);
+  ++size_;
+}
+
+template <class T>
+void ring_buffer<T>::pop_back() {
+  if (!size_) return;
+  slot(size_ - 1)->~T();
+  --size_;
+}
+
+template <class T>
+void ring_buffer<T>::pop_front() {
+  if (!size_) return;
+  slot(0)->~T();
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <class T>
+void ring_buffer<T>::swap(ring_buffer &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+template <class T>
+template <class... Args>
+void ring_buffer<T>::insert_many_back(Args &&...args) {
+  (push_back(args), ...);
+}
+
+// Moves the elements to the start of a new buffer of the given capacity,
+// which must hold them all.
+template <class T>
+void ring_buffer<T>::reallocate(size_type capacity) {
+  std::allocator<T> allocator;
+  T *data = capacity ? allocator.allocate(capacity) : nullptr;
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      new (data + moved) T(std::move_if_noexcept(*slot(moved)));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) data[i].~T();
+    if (data) allocator.deallocate(data, capacity);
+    throw;
+  }
+  size_type size = size_;
+  clear();
+  if (data_) allocator.deallocate(data_, capacity_);
+  data_ = data;
+  capacity_ = capacity;
+  size_ = size;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_RING_BUFFER_H
@@ -1,6 +1,9 @@
 #ifndef __MY_CONTAINERS_MY_SET_H__
 #define __MY_CONTAINERS_MY_SET_H__
 
+#include <initializer_list>
+#include <utility>
+
 #include "my_tree.h"
 
 namespace mycontainers {
@@ -50,9 +53,34 @@ class MySet {
     return tree_.insertToTree(value);
   }
   void erase(iterator pos) { tree_.erase(pos); }
+  // Erases the elements satisfying pred in O(n) and returns their number.
+  template <class Predicate>
+  size_type remove_if(Predicate pred) {
+    return tree_.eraseIf(
+        [&pred](const auto &item) { return pred(item.first); });
+  }
   void swap(MySet &other) { std::swap(tree_, other.tree_); }
   void merge(MySet &other) { tree_.merge(other.tree_); }
 
+  // Set algebra in O(m log(n / m + 1)); other is consumed and left empty.
+  // With other being *this, only set_difference changes it (to empty).
+  void set_union(MySet &other, bool parallel = false) {
+    tree_.setUnion(other.tree_, false, parallel);
+  }
+  void set_intersection(MySet &other, bool parallel = false) {
+    tree_.setIntersection(other.tree_, false, parallel);
+  }
+  void set_difference(MySet &other, bool parallel = false) {
+    tree_.setDifference(other.tree_, false, parallel);
+  }
+  // Moves the elements not less than key into the returned container in
+  // O(log n + min(k, n - k)), where k elements stay.
+  MySet split(const key_type &key) {
+    MySet greater;
+    greater.tree_ = tree_.split(key, false);
+    return greater;
+  }
+
   iterator find(const key_type &key) const noexcept { return tree_.find(key); }
   bool contains(const key_type &key) const noexcept {
     return tree_.contains(key);
@@ -69,6 +97,11 @@ class MySet {
   BinaryTree<key_type, value_type> tree_;
 };  // class MySet
 
+template <class Key, class Predicate>
+typename MySet<Key>::size_type erase_if(MySet<Key> &s, Predicate pred) {
+  return s.remove_if(pred);
+}
+
 }  // namespace mycontainers
 
 #endif  // __MY_CONTAINERS_MY_SET_H__
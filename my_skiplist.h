@@ -0,0 +1,409 @@
+#ifndef MY_CONTAINERS_MY_SKIPLIST_H
+#define MY_CONTAINERS_MY_SKIPLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mycontainers {
+
+// Ordered skip list of unique keys behind skiplist_set and skiplist_map;
+// KeyOf extracts the key from a stored Value. A node reaches one level
+// more than the previous with the probability given on construction, so
+// searches take O(log n) expected steps. Insertion and erasure relink only
+// the predecessors of the node and never rebalance, and the bottom level
+// is a plain linked list for range scans. An iterator keeps a pointer to
+// its list to step back from end() to the tail; swap, move and merge carry
+// the nodes over but not the iterators' lists, so afterwards iterators to
+// the moved elements may still be dereferenced and incremented, but one
+// that has reached end() must not be decremented.
+template <class Key, class Value, class KeyOf>
+class SkipList {
+  class Node;
+  class SkipListConstIterator;
+  class SkipListIterator;
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using iterator = SkipListIterator;
+  using const_iterator = SkipListConstIterator;
+  using size_type = size_t;
+
+  static constexpr double kDefaultProbability = 0.25;
+
+  explicit SkipList(double probability = kDefaultProbability);
+  SkipList(const SkipList &other);
+  SkipList(SkipList &&other) noexcept;
+  ~SkipList() { clear(); }
+
+  SkipList &operator=(const SkipList &other);
+  SkipList &operator=(SkipList &&other) noexcept;
+
+  double probability() const noexcept { return probability_; }
+
+  iterator begin() const { return iterator(head_[0], this); }
+  iterator end() const { return iterator(nullptr, this); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);
+  void swap(SkipList &other) noexcept;
+  // Moves the nodes of other whose keys are missing here; the rest stay.
+  void merge(SkipList &other);
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+
+ private:
+  static constexpr int kMaxHeight = 32;
+
+  static const key_type &keyOf(const Node *node) {
+    return KeyOf()(node->value_);
+  }
+  Node **head() const { return const_cast<Node **>(head_); }
+  void findLinks(const key_type &key, Node ***links) const;
+  void linkNode(Node *node, Node ***links);
+  void unlinkNode(Node *node, Node ***links);
+  int randomHeight();
+
+  // head_[level] is the first node reaching level; levels at or above
+  // height_ are empty.
+  Node *head_[kMaxHeight] = {};
+  Node *tail_ = nullptr;
+  int height_ = 1;
+  size_type size_ = 0;
+  double probability_;
+  std::uint64_t threshold_;
+  std::uint64_t state_;
+};  // class SkipList
+
+// The tower of next links is allocated inline, right after the node.
+template <class Key, class Value, class KeyOf>
+class SkipList<Key, Value, KeyOf>::Node {
+ public:
+  static Node *create(const value_type &value, int height);
+  static void destroy(Node *node) {
+    node->~Node();
+    ::operator delete(node);
+  }
+
+  Node **next() { return reinterpret_cast<Node **>(this + 1); }
+
+  value_type value_;
+  Node *prev_ = nullptr;
+  int height_;
+
+ private:
+  Node(const value_type &value, int height) : value_(value), height_(height) {}
+};  // class Node
+
+template <class Key, class Value, class KeyOf>
+class SkipList<Key, Value, KeyOf>::SkipListConstIterator {
+ public:
+  SkipListConstIterator() = default;
+  SkipListConstIterator(Node *node, const SkipList *list)
+      : node_(node), list_(list) {}
+
+  const value_type &operator*() const { return node_->value_; }
+  const value_type *operator->() const { return &node_->value_; }
+  SkipListConstIterator operator++() {
+    node_ = node_->next()[0];
+    return *this;
+  }
+  SkipListConstIterator operator--() {
+    node_ = node_ ? node_->prev_ : list_->tail_;
+    return *this;
+  }
+  bool operator==(const SkipListConstIterator it) const {
+    return node_ == it.node_;
+  }
+  bool operator!=(const SkipListConstIterator it) const {
+    return node_ != it.node_;
+  }
+
+ protected:
+  friend class SkipList;
+
+  Node *node_ = nullptr;
+  const SkipList *list_ = nullptr;
+};  // class SkipListConstIterator
+
+template <class Key, class Value, class KeyOf>
+class SkipList<Key, Value, KeyOf>::SkipListIterator
+    : public SkipListConstIterator {
+ public:
+  using SkipListConstIterator::SkipListConstIterator;
+
+  value_type &operator*() const { return this->node_->value_; }
+  value_type *operator->() const { return &this->node_->value_; }
+  SkipListIterator operator++() {
+    SkipListConstIterator::operator++();
+    return *this;
+  }
+  SkipListIterator operator--() {
+    SkipListConstIterator::operator--();
+    return *this;
+  }
+};  // class SkipListIterator
+
+template <class Key, class Value, class KeyOf>
+typename SkipList<Key, Value, KeyOf>::Node *
+SkipList<Key, Value, KeyOf>::Node::create(const value_type &value,
+                                          int height) {
+  void *raw = ::operator new(sizeof(Node) + height * sizeof(Node *));
+  Node *node = nullptr;
+  try {
+    node = new (raw) Node(value, height);
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+  for (int level = 0; level < height; ++level) node->next()[level] = nullptr;
+  return node;
+}
+
+template <class Key, class Value, class KeyOf>
+SkipList<Key, Value, KeyOf>::SkipList(double probability)
+    : probability_(probability),
+      state_(reinterpret_cast<std::uintptr_t>(this) * 0x9E3779B97F4A7C15ull |
+             1) {
+  if (!(probability > 0 && probability < 1)) {
+    throw std::invalid_argument("mycontainers::SkipList::probability");
+  }
+  threshold_ = std::uint64_t(probability * 4294967296.0);
+}
+
+// Nodes are appended in order with the heights they had in other, so the
+// copy has the same shape and takes O(n).
+template <class Key, class Value, class KeyOf>
+SkipList<Key, Value, KeyOf>::SkipList(const SkipList &other)
+    : SkipList(other.probability_) {
+  Node **last[kMaxHeight];
+  for (int level = 0; level < kMaxHeight; ++level) last[level] = head_;
+  try {
+    for (Node *source = other.head_[0]; source;
+         source = source->next()[0]) {
+      Node *node = Node::create(source->value_, source->height_);
+      for (int level = 0; level < node->height_; ++level) {
+        last[level][level] = node;
+        last[level] = node->next();
+      }
+      node->prev_ = tail_;
+      tail_ = node;
+      ++size_;
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+  height_ = other.height_;
+}
+
+template <class Key, class Value, class KeyOf>
+SkipList<Key, Value, KeyOf>::SkipList(SkipList &&other) noexcept
+    : SkipList(other.probability_) {
+  swap(other);
+}
+
+template <class Key, class Value, class KeyOf>
+SkipList<Key, Value, KeyOf> &SkipList<Key, Value, KeyOf>::operator=(
+    const SkipList &other) {
+  SkipList tmp(other);
+  swap(tmp);
+  return *this;
+}
+
+template <class Key, class Value, class KeyOf>
+SkipList<Key, Value, KeyOf> &SkipList<Key, Value, KeyOf>::operator=(
+    SkipList &&other) noexcept {
+  swap(other);
+  return *this;
+}
+
+template <class Key, class Value, class KeyOf>
+size_t SkipList<Key, Value, KeyOf>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / 2 /
+         (sizeof(Node) + sizeof(Node *));
+}
+
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::clear() {
+  for (Node *node = head_[0]; node;) {
+    Node *next = node->next()[0];
+    Node::destroy(node);
+    node = next;
+  }
+  for (Node *&first : head_) first = nullptr;
+  tail_ = nullptr;
+  height_ = 1;
+  size_ = 0;
+}
+
+template <class Key, class Value, class KeyOf>
+std::pair<typename SkipList<Key, Value, KeyOf>::iterator, bool>
+SkipList<Key, Value, KeyOf>::insert(const value_type &value) {
+  const key_type &key = KeyOf()(value);
+  Node **links[kMaxHeight];
+  findLinks(key, links);
+  Node *next = links[0][0];
+  if (next && !(key < keyOf(next))) {
+    return std::pair<iterator, bool>(iterator(next, this), false);
+  }
+  Node *node = Node::create(value, randomHeight());
+  linkNode(node, links);
+  return std::pair<iterator, bool>(iterator(node, this), true);
+}
+
+template <class Key, class Value, class KeyOf>
+typename SkipList<Key, Value, KeyOf>::iterator
+SkipList<Key, Value, KeyOf>::erase(const_iterator pos) {
+  Node *node = pos.node_;
+  if (!node) return end();
+  Node *next = node->next()[0];
+  Node **links[kMaxHeight];
+  findLinks(keyOf(node), links);
+  unlinkNode(node, links);
+  Node::destroy(node);
+  return iterator(next, this);
+}
+
+template <class Key, class Value, class KeyOf>
+size_t SkipList<Key, Value, KeyOf>::erase(const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) return 0;
+  erase(it);
+  return 1;
+}
+
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::swap(SkipList &other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(height_, other.height_);
+  std::swap(size_, other.size_);
+  std::swap(probability_, other.probability_);
+  std::swap(threshold_, other.threshold_);
+}
+
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::merge(SkipList &other) {
+  if (this == &other) return;
+  Node **links[kMaxHeight];
+  Node **otherLinks[kMaxHeight];
+  for (Node *node = other.head_[0]; node;) {
+    Node *next = node->next()[0];
+    findLinks(keyOf(node), links);
+    Node *found = links[0][0];
+    if (!found || keyOf(node) < keyOf(found)) {
+      other.findLinks(keyOf(node), otherLinks);
+      other.unlinkNode(node, otherLinks);
+      for (int level = 0; level < node->height_; ++level) {
+        node->next()[level] = nullptr;
+      }
+      linkNode(node, links);
+    }
+    node = next;
+  }
+}
+
+template <class Key, class Value, class KeyOf>
+typename SkipList<Key, Value, KeyOf>::iterator
+SkipList<Key, Value, KeyOf>::find(const key_type &key) const {
+  iterator it = lower_bound(key);
+  if (it != end() && key < keyOf(it.node_)) return end();
+  return it;
+}
+
+template <class Key, class Value, class KeyOf>
+typename SkipList<Key, Value, KeyOf>::iterator
+SkipList<Key, Value, KeyOf>::lower_bound(const key_type &key) const {
+  Node **links = head();
+  for (int level = height_ - 1; level >= 0; --level) {
+    while (links[level] && keyOf(links[level]) < key) {
+      links = links[level]->next();
+    }
+  }
+  return iterator(links[0], this);
+}
+
+template <class Key, class Value, class KeyOf>
+typename SkipList<Key, Value, KeyOf>::iterator
+SkipList<Key, Value, KeyOf>::upper_bound(const key_type &key) const {
+  Node **links = head();
+  for (int level = height_ - 1; level >= 0; --level) {
+    while (links[level] && !(key < keyOf(links[level]))) {
+      links = links[level]->next();
+    }
+  }
+  return iterator(links[0], this);
+}
+
+// Sets links[level] to the next links of the last node before key at each
+// level, or to head_ if there is none, for all levels in use.
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::findLinks(const key_type &key,
+                                            Node ***links) const {
+  Node **current = head();
+  for (int level = height_ - 1; level >= 0; --level) {
+    while (current[level] && keyOf(current[level]) < key) {
+      current = current[level]->next();
+    }
+    links[level] = current;
+  }
+}
+
+// Links node after the predecessors found by findLinks for its key.
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::linkNode(Node *node, Node ***links) {
+  for (; height_ < node->height_; ++height_) links[height_] = head_;
+  for (int level = 0; level < node->height_; ++level) {
+    node->next()[level] = links[level][level];
+    links[level][level] = node;
+  }
+  Node *next = node->next()[0];
+  node->prev_ = next ? next->prev_ : tail_;
+  (next ? next->prev_ : tail_) = node;
+  ++size_;
+}
+
+template <class Key, class Value, class KeyOf>
+void SkipList<Key, Value, KeyOf>::unlinkNode(Node *node, Node ***links) {
+  for (int level = 0; level < node->height_; ++level) {
+    links[level][level] = node->next()[level];
+  }
+  Node *next = node->next()[0];
+  (next ? next->prev_ : tail_) = node->prev_;
+  while (height_ > 1 && !head_[height_ - 1]) --height_;
+  --size_;
+}
+
+// Each extra level is taken with the configured probability; the
+// xorshift state is per list, so lists on different threads do not share
+// it.
+template <class Key, class Value, class KeyOf>
+int SkipList<Key, Value, KeyOf>::randomHeight() {
+  int height = 1;
+  while (height < kMaxHeight) {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 7;
+    state_ ^= state_ << 17;
+    if ((state_ >> 32) >= threshold_) break;
+    ++height;
+  }
+  return height;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_SKIPLIST_H
@@ -0,0 +1,113 @@
+#ifndef MY_CONTAINERS_MY_SKIPLIST_MAP_H
+#define MY_CONTAINERS_MY_SKIPLIST_MAP_H
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "my_skiplist.h"
+#include "my_vector.h"
+
+namespace mycontainers {
+
+// Map with the interface of MyMap on top of a skip list instead of a
+// red-black tree.
+template <class Key, class T>
+class skiplist_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using List = SkipList<Key, value_type, KeyOfValue>;
+
+ public:
+  using iterator = typename List::iterator;
+  using const_iterator = typename List::const_iterator;
+  using size_type = size_t;
+
+  skiplist_map() = default;
+  // probability is the chance of a node to reach each next level.
+  explicit skiplist_map(double probability) : list_(probability) {}
+  skiplist_map(std::initializer_list<value_type> const &items) {
+    for (auto &item : items) list_.insert(item);
+  }
+
+  double level_probability() const noexcept { return list_.probability(); }
+
+  mapped_type &at(const Key &key) const;
+  // Constructs a mapped_type only when key is missing.
+  mapped_type &operator[](const Key &key);
+
+  iterator begin() const noexcept { return list_.begin(); }
+  iterator end() const noexcept { return list_.end(); }
+
+  bool empty() const noexcept { return list_.empty(); }
+  size_type size() const noexcept { return list_.size(); }
+  size_type max_size() const noexcept { return list_.max_size(); }
+
+  void clear() { list_.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return list_.insert(value);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const mapped_type &obj) {
+    return list_.insert(value_type(key, obj));
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos) { list_.erase(pos); }
+  size_type erase(const key_type &key) { return list_.erase(key); }
+  void swap(skiplist_map &other) noexcept { list_.swap(other.list_); }
+  void merge(skiplist_map &other) { list_.merge(other.list_); }
+
+  iterator find(const Key &key) const { return list_.find(key); }
+  bool contains(const Key &key) const { return list_.contains(key); }
+  iterator lower_bound(const Key &key) const { return list_.lower_bound(key); }
+  iterator upper_bound(const Key &key) const { return list_.upper_bound(key); }
+
+  template <typename... Args>
+  mycontainers::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    mycontainers::vector<std::pair<iterator, bool>> result;
+    (result.push_back(list_.insert(args)), ...);
+    return result;
+  }
+
+ private:
+  List list_;
+};  // class skiplist_map
+
+template <class Key, class T>
+T &skiplist_map<Key, T>::at(const Key &key) const {
+  iterator it = list_.find(key);
+  if (it == list_.end()) {
+    throw std::out_of_range("mycontainers::skiplist_map::at");
+  }
+  return it->second;
+}
+
+template <class Key, class T>
+T &skiplist_map<Key, T>::operator[](const Key &key) {
+  iterator it = list_.find(key);
+  if (it != list_.end()) return it->second;
+  return list_.insert(value_type(key, mapped_type())).first->second;
+}
+
+template <class Key, class T>
+std::pair<typename skiplist_map<Key, T>::iterator, bool>
+skiplist_map<Key, T>::insert_or_assign(const Key &key, const mapped_type &obj) {
+  std::pair<iterator, bool> result = list_.insert(value_type(key, obj));
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_SKIPLIST_MAP_H
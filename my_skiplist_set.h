@@ -0,0 +1,77 @@
+#ifndef MY_CONTAINERS_MY_SKIPLIST_SET_H
+#define MY_CONTAINERS_MY_SKIPLIST_SET_H
+
+#include <initializer_list>
+#include <utility>
+
+#include "my_skiplist.h"
+#include "my_vector.h"
+
+namespace mycontainers {
+
+// Set with the interface of MySet on top of a skip list instead of a
+// red-black tree.
+template <class Key>
+class skiplist_set {
+  struct KeyOfValue {
+    const Key &operator()(const Key &key) const { return key; }
+  };
+  using List = SkipList<Key, Key, KeyOfValue>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename List::const_iterator;
+  using const_iterator = typename List::const_iterator;
+  using size_type = size_t;
+
+  skiplist_set() = default;
+  // probability is the chance of a node to reach each next level.
+  explicit skiplist_set(double probability) : list_(probability) {}
+  skiplist_set(std::initializer_list<value_type> const &items) {
+    for (auto &item : items) list_.insert(item);
+  }
+
+  double level_probability() const noexcept { return list_.probability(); }
+
+  iterator begin() const noexcept { return list_.begin(); }
+  iterator end() const noexcept { return list_.end(); }
+
+  bool empty() const noexcept { return list_.empty(); }
+  size_type size() const noexcept { return list_.size(); }
+  size_type max_size() const noexcept { return list_.max_size(); }
+
+  void clear() { list_.clear(); }
+  std::pair<iterator, bool> insert(const_reference value) {
+    return list_.insert(value);
+  }
+  void erase(iterator pos) { list_.erase(pos); }
+  size_type erase(const key_type &key) { return list_.erase(key); }
+  void swap(skiplist_set &other) noexcept { list_.swap(other.list_); }
+  void merge(skiplist_set &other) { list_.merge(other.list_); }
+
+  iterator find(const key_type &key) const { return list_.find(key); }
+  bool contains(const key_type &key) const { return list_.contains(key); }
+  iterator lower_bound(const key_type &key) const {
+    return list_.lower_bound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return list_.upper_bound(key);
+  }
+
+  template <typename... Args>
+  mycontainers::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    mycontainers::vector<std::pair<iterator, bool>> result;
+    (result.push_back(list_.insert(args)), ...);
+    return result;
+  }
+
+ private:
+  List list_;
+};  // class skiplist_set
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_SKIPLIST_SET_H
@@ -0,0 +1,204 @@
+#ifndef MY_CONTAINERS_MY_SPSC_QUEUE_H
+#define MY_CONTAINERS_MY_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mycontainers {
+
+// Bounded lock-free queue between exactly one producer thread, which calls
+// push and push_n, and one consumer thread, which calls front, pop and
+// pop_n; empty, size and capacity may be called from either. The elements
+// sit in a power-of-two ring addressed by ever-growing head and tail
+// indices. Each index lives on its own cache line together with the
+// owner's cached copy of the other index, so a thread reads the remote
+// line only when its cached copy says the ring is full (or empty).
+template <class T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Rounds capacity up to a power of two.
+  explicit spsc_queue(size_type capacity = kDefaultCapacity);
+  spsc_queue(const spsc_queue &q) = delete;
+  spsc_queue(spsc_queue &&q) = delete;
+  ~spsc_queue();
+
+  spsc_queue &operator=(const spsc_queue &q) = delete;
+  spsc_queue &operator=(spsc_queue &&q) = delete;
+
+  // The queue must not be empty.
+  reference front();
+
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept { return mask_ + 1; }
+  size_type max_size() const noexcept;
+
+  // Return false, leaving the queue unchanged, when it is full.
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+  void pop();
+  // Push up to count elements read from first and pop up to count elements
+  // into out, publishing them with a single index update; return the
+  // number of elements transferred. If transferring an element throws, the
+  // elements transferred before it are published and the rest stay put.
+  template <class InputIt>
+  size_type push_n(InputIt first, size_type count);
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type count);
+
+ private:
+  static constexpr size_type kDefaultCapacity = 1024;
+  static constexpr size_type kCacheLine = 64;
+
+  T *slot(size_type index) const { return data_ + (index & mask_); }
+  template <class Value>
+  bool emplace(Value &&value);
+  size_type freeSlots(size_type tail, size_type count);
+  size_type readySlots(size_type head, size_type count);
+
+  // Read-only after construction.
+  T *data_;
+  size_type mask_;
+  // Written by the consumer.
+  alignas(kCacheLine) std::atomic<size_type> head_{0};
+  size_type cachedTail_ = 0;
+  // Written by the producer.
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};
+  size_type cachedHead_ = 0;
+};  // class spsc_queue
+
+template <class T>
+spsc_queue<T>::spsc_queue(size_type capacity) {
+  if (capacity > max_size()) {
+    throw std::length_error("mycontainers::spsc_queue");
+  }
+  size_type rounded = 1;
+  while (rounded < capacity) rounded *= 2;
+  data_ = std::allocator<T>().allocate(rounded);
+  mask_ = rounded - 1;
+}
+
+template <class T>
+spsc_queue<T>::~spsc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    slot(i)->~T();
+  }
+  std::allocator<T>().deallocate(data_, mask_ + 1);
+}
+
+// The head is loaded first, so the tail read after it is never behind.
+template <class T>
+size_t spsc_queue<T>::size() const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <class T>
+size_t spsc_queue<T>::max_size() const noexcept {
+  size_type limit = std::numeric_limits<size_type>::max() / 2 / sizeof(T);
+  size_type power = 1;
+  while (power <= limit / 2) power *= 2;
+  return power;
+}
+
+template <class T>
+T &spsc_queue<T>::front() {
+  size_type head = head_.load(std::memory_order_relaxed);
+  readySlots(head, 1);
+  return *slot(head);
+}
+
+template <class T>
+void spsc_queue<T>::pop() {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (!readySlots(head, 1)) return;
+  slot(head)->~T();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <class T>
+template <class InputIt>
+size_t spsc_queue<T>::push_n(InputIt first, size_type count) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  count = freeSlots(tail, count);
+  size_type pushed = 0;
+  try {
+    for (; pushed < count; ++pushed, ++first) {
+      new (slot(tail + pushed)) T(*first);
+    }
+  } catch (...) {
+    tail_.store(tail + pushed, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <class T>
+template <class OutputIt>
+size_t spsc_queue<T>::pop_n(OutputIt out, size_type count) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  count = readySlots(head, count);
+  size_type popped = 0;
+  try {
+    for (; popped < count; ++popped, ++out) {
+      T *item = slot(head + popped);
+      *out = std::move(*item);
+      item->~T();
+    }
+  } catch (...) {
+    head_.store(head + popped, std::memory_order_release);
+    throw;
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+template <class T>
+template <class Value>
+bool spsc_queue<T>::emplace(Value &&value) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (!freeSlots(tail, 1)) return false;
+  new (slot(tail)) T(std::forward<Value>(value));
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// Producer side: how many of count slots are free, refreshing the cached
+// head only when the cache cannot grant them all.
+template <class T>
+size_t spsc_queue<T>::freeSlots(size_type tail, size_type count) {
+  size_type free = capacity() - (tail - cachedHead_);
+  if (free < count) {
+    cachedHead_ = head_.load(std::memory_order_acquire);
+    free = capacity() - (tail - cachedHead_);
+  }
+  return free < count ? free : count;
+}
+
+// Consumer side: how many of count elements are ready, refreshing the
+// cached tail only when the cache cannot grant them all.
+template <class T>
+size_t spsc_queue<T>::readySlots(size_type head, size_type count) {
+  size_type ready = cachedTail_ - head;
+  if (ready < count) {
+    cachedTail_ = tail_.load(std::memory_order_acquire);
+    ready = cachedTail_ - head;
+  }
+  return ready < count ? ready : count;
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_SPSC_QUEUE_H
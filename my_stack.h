@@ -1,13 +1,26 @@
 #ifndef MY_CONTAINERS_MY_STACK_H
 #define MY_CONTAINERS_MY_STACK_H
 
-#include "my_list.h"
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "my_iterator.h"
+#include "my_vector.h"
 
 namespace mycontainers {
 
-template <class T>
+// Adapter over Container, which needs back, push_back, pop_back, empty and
+// size, plus insert_many_back if insert_many_front is used. The default
+// vector keeps the elements contiguous, so a push allocates only when it
+// grows; list or any other type with these members may be used instead.
+template <class T, class Container = mycontainers::vector<T>>
 class MyStack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
@@ -15,6 +28,8 @@ class MyStack {
 
   MyStack() : c_() {}
   MyStack(std::initializer_list<value_type> const &items) : c_(items) {}
+  explicit MyStack(const Container &c) : c_(c) {}
+  explicit MyStack(Container &&c) : c_(std::move(c)) {}
   MyStack(const MyStack &s) : c_(s.c_) {}
   MyStack(MyStack &&s) noexcept : c_(std::move(s.c_)) {}
   ~MyStack() {}
@@ -32,6 +47,7 @@ class MyStack {
     return *this;
   }
 
+  reference top() { return c_.back(); }
   const_reference top() const { return c_.back(); }
 
   bool empty() const noexcept { return c_.empty(); }
@@ -43,13 +59,53 @@ class MyStack {
   }
   void swap(MyStack &other) { std::swap(c_, other.c_); }
 
+  // Move the top element out instead of copying it before pop().
+  value_type pop_value() {
+    if (c_.empty()) throw std::out_of_range("mycontainers::MyStack::pop_value");
+    value_type value(std::move(c_.back()));
+    c_.pop_back();
+    return value;
+  }
+  std::optional<value_type> try_pop() {
+    if (c_.empty()) return std::nullopt;
+    std::optional<value_type> value(std::move(c_.back()));
+    c_.pop_back();
+    return value;
+  }
+  // Moves up to n elements, top first, to out and returns their number.
+  template <class OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type popped = 0;
+    for (; popped < n && !c_.empty(); ++popped, ++out) {
+      *out = std::move(c_.back());
+      c_.pop_back();
+    }
+    return popped;
+  }
+  // Pushes [first, last) in order, so *(last - 1) ends up on top; the
+  // container grows at most once when the range length is known.
+  template <class InputIt>
+  void push_range(InputIt first, InputIt last) {
+    if constexpr (is_forward_iterator_v<InputIt>) {
+      reserve(c_, c_.size() + std::distance(first, last), 0);
+    }
+    for (; first != last; ++first) c_.push_back(*first);
+  }
+
   template <class... Args>
   void insert_many_front(Args &&...args) {
     c_.insert_many_back(args...);
   }
 
  private:
-  mycontainers::list<value_type> c_;
+  template <class C>
+  static auto reserve(C &c, size_type n, int) -> decltype(c.reserve(n)) {
+    return c.reserve(n);
+  }
+  template <class C>
+  static void reserve(C &, size_type, long) {}
+
+  Container c_;
 };
 
 }  // namespace mycontainers
@@ -1,6 +1,14 @@
 #ifndef __MY_CONTAINERS_MY_TREE_H__
 #define __MY_CONTAINERS_MY_TREE_H__
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "my_parallel.h"
 #include "my_vector.h"
 
 namespace mycontainers {
@@ -49,8 +57,28 @@ class BinaryTree {
                                            const value_type &value);
 
   void erase(iterator pos);
+  // Erases the nodes whose key and value pair satisfies pred by relinking
+  // the kept ones into a new tree in O(n). Returns the number erased.
+  template <class Predicate>
+  size_type eraseIf(Predicate pred);
   void merge(BinaryTree &other, bool multi = false);
 
+  // Join-based set algebra. The result replaces this tree and other is left
+  // empty; nodes are relinked, never copied. In multi mode equal keys are
+  // counted: union keeps the larger count, intersection the smaller and
+  // difference subtracts. With parallel set, independent subtrees are
+  // combined on separate threads.
+  void setUnion(BinaryTree &other, bool multi = false, bool parallel = false);
+  void setIntersection(BinaryTree &other, bool multi = false,
+                       bool parallel = false);
+  void setDifference(BinaryTree &other, bool multi = false,
+                     bool parallel = false);
+  // Keeps the keys less than key and returns the rest. Cutting the tree
+  // takes O(log n), but nodes keep no subtree sizes, so recounting the two
+  // parts adds O(min(k, n - k)) for k kept keys, and a multi split
+  // rebuilds the keys equal to key.
+  BinaryTree split(const Key &key, bool multi = false);
+
   iterator find(const Key &key) const noexcept;
   bool contains(const Key &key) const noexcept;
   size_type count(const Key &key) const noexcept;
@@ -60,9 +88,55 @@ class BinaryTree {
   iterator upper_bound(const Key &key) const;
 
  private:
+  enum class SetOperation { kUnion, kSum, kIntersection, kDifference };
+
+  // A detached red-black tree with a black root and its black height.
+  struct Subtree {
+    Node *root = nullptr;
+    int blackHeight = 0;
+  };
+
+  // Nodes with equal keys chained through their right links.
+  struct Group {
+    Node *first = nullptr;
+    Node *last = nullptr;
+    size_type count = 0;
+  };
+
+  struct SplitResult {
+    Subtree less;
+    Group equal;
+    Subtree greater;
+  };
+
+  // Subtrees with a smaller black height are not worth a thread.
+  static constexpr int kParallelBlackHeight = 10;
+
   void swap(BinaryTree &other);
   void clearTree(Node *root, BinaryTree &tree);
-  void mergeTree(Node *node, BinaryTree *other, BinaryTree *tmp, bool multi);
+  void combine(BinaryTree &other, SetOperation operation, bool multi,
+               bool parallel, bool keepLeftovers);
+  static Subtree combineTrees(Subtree first, Subtree second,
+                              SetOperation operation, bool multi, int depth,
+                              Group *leftovers, size_type &dropped);
+  static Subtree insertLeaf(Subtree tree, Node *node, bool multi,
+                            Group *leftovers, size_type &dropped);
+  static SplitResult splitTree(Subtree tree, const Key &key, bool multi);
+  static Subtree splitLast(Subtree tree, Node *&last);
+  static Subtree joinTrees(Subtree left, Node *node, Subtree right);
+  static Subtree joinTrees(Subtree left, Subtree right);
+  static Subtree detachChild(Node *child, int blackHeight);
+  static Subtree buildTree(Group group);
+  static Node *buildBalanced(Node *&chain, size_type count, int depth,
+                             int redDepth);
+  static void flattenTree(Node *node, Group &group);
+  static int blackHeight(Node *node);
+  static Group makeGroup(Node *node);
+  static void appendGroup(Group &group, Group other);
+  static Group takeFront(Group &group, size_type count);
+  static size_type deleteGroup(Group group);
+  static size_type deleteTree(Node *node);
+  static size_type countFirst(Node *first, Node *second, size_type total);
   Node *copyTree(const Node *root);
   Node *getMinNode() const;
   Node *getMaxNode(Node *node) const;
@@ -101,7 +175,7 @@ BinaryTree<Key, T> &BinaryTree<Key, T>::operator=(
 template <class Key, class T>
 BinaryTree<Key, T> &BinaryTree<Key, T>::operator=(
     BinaryTree<Key, T> &&other) noexcept {
-  BinaryTree tmp(other);
+  BinaryTree tmp(std::move(other));
   swap(tmp);
   return *this;
 }
@@ -222,6 +296,38 @@ void BinaryTree<Key, T>::erase(iterator pos) {
   --nodeCount_;
 }
 
+// If pred throws, the nodes not yet tested are kept.
+template <class Key, class T>
+template <class Predicate>
+typename BinaryTree<Key, T>::size_type BinaryTree<Key, T>::eraseIf(
+    Predicate pred) {
+  Group nodes;
+  flattenTree(root_, nodes);
+  Group kept;
+  Group erased;
+  auto rebuild = [this, &kept, &erased] {
+    root_ = buildTree(kept).root;
+    nodeCount_ = kept.count;
+    return deleteGroup(erased);
+  };
+  Node *node = nodes.first;
+  try {
+    while (node) {
+      Node *next = node->getRight();
+      const std::pair<key_type, value_type> &item = *node->getPair();
+      Group &target = pred(item) ? erased : kept;
+      appendGroup(target, makeGroup(node));
+      node = next;
+    }
+  } catch (...) {
+    size_type untested = nodes.count - kept.count - erased.count;
+    appendGroup(kept, Group{node, nodes.last, untested});
+    rebuild();
+    throw;
+  }
+  return rebuild();
+}
+
 template <class Key, class T>
 void BinaryTree<Key, T>::eraseBalancing(Node *node) {
   if (!node || !(node->getBrother())) return;
@@ -303,16 +409,40 @@ void BinaryTree<Key, T>::swap(BinaryTree &other) {
 
 template <class Key, class T>
 void BinaryTree<Key, T>::merge(BinaryTree &other, bool multi) {
-  BinaryTree<Key, T> tmp;
-  mergeTree(other.root_, &other, &tmp, multi);
-  if (multi) {
-    clearTree(other.root_, other);
-    other.root_ = nullptr;
-  } else {
-    other.swap(tmp);
-    clearTree(tmp.root_, tmp);
-    tmp.root_ = nullptr;
-  }
+  combine(other, multi ? SetOperation::kSum : SetOperation::kUnion, multi,
+          false, true);
+}
+
+template <class Key, class T>
+void BinaryTree<Key, T>::setUnion(BinaryTree &other, bool multi,
+                                  bool parallel) {
+  combine(other, SetOperation::kUnion, multi, parallel, false);
+}
+
+template <class Key, class T>
+void BinaryTree<Key, T>::setIntersection(BinaryTree &other, bool multi,
+                                         bool parallel) {
+  combine(other, SetOperation::kIntersection, multi, parallel, false);
+}
+
+template <class Key, class T>
+void BinaryTree<Key, T>::setDifference(BinaryTree &other, bool multi,
+                                       bool parallel) {
+  combine(other, SetOperation::kDifference, multi, parallel, false);
+}
+
+template <class Key, class T>
+BinaryTree<Key, T> BinaryTree<Key, T>::split(const Key &key, bool multi) {
+  SplitResult parts = splitTree(Subtree{root_, blackHeight(root_)}, key, multi);
+  Subtree upper = joinTrees(buildTree(parts.equal), parts.greater);
+
+  BinaryTree greater;
+  size_type total = nodeCount_;
+  root_ = parts.less.root;
+  nodeCount_ = countFirst(root_, upper.root, total);
+  greater.root_ = upper.root;
+  greater.nodeCount_ = total - nodeCount_;
+  return greater;
 }
 
 template <class Key, class T>
@@ -329,8 +459,8 @@ bool BinaryTree<Key, T>::contains(const Key &key) const noexcept {
 template <class Key, class T>
 size_t BinaryTree<Key, T>::count(const Key &key) const noexcept {
   size_type count = 0;
-  iterator it = find(key);
-  for (; it != iterator(nullptr, this) && *it == key; ++it) {
+  iterator last = upper_bound(key);
+  for (iterator it = lower_bound(key); it != last; ++it) {
     ++count;
   }
   return count;
@@ -340,30 +470,37 @@ template <class Key, class T>
 std::pair<typename BinaryTree<Key, T>::iterator,
           typename BinaryTree<Key, T>::iterator>
 BinaryTree<Key, T>::equal_range(const Key &key) const {
-  iterator itBegin = find(key);
-  iterator itEnd = itBegin;
-
-  for (; itEnd != iterator(nullptr, this) && *itEnd == key; ++itEnd) {
-  }
-  return std::pair<iterator, iterator>(itBegin, itEnd);
+  return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
 }
 
 template <class Key, class T>
 typename BinaryTree<Key, T>::iterator BinaryTree<Key, T>::lower_bound(
     const Key &key) const {
-  iterator it = begin();
-  for (; it != end() && *it < key; ++it) {
+  Node *bound = nullptr;
+  for (Node *node = root_; node;) {
+    if (node->getKey() < key) {
+      node = node->getRight();
+    } else {
+      bound = node;
+      node = node->getLeft();
+    }
   }
-  return it;
+  return iterator(bound, this);
 }
 
 template <class Key, class T>
 typename BinaryTree<Key, T>::iterator BinaryTree<Key, T>::upper_bound(
     const Key &key) const {
-  iterator it = begin();
-  for (; it != end() && *it <= key; ++it) {
+  Node *bound = nullptr;
+  for (Node *node = root_; node;) {
+    if (key < node->getKey()) {
+      bound = node;
+      node = node->getLeft();
+    } else {
+      node = node->getRight();
+    }
   }
-  return it;
+  return iterator(bound, this);
 }
 
 template <class Key, class T>
@@ -463,18 +600,397 @@ typename BinaryTree<Key, T>::Node *BinaryTree<Key, T>::getPrevNode(
   return (prev != node) ? prev : nullptr;
 }
 
+// Nodes of other whose keys are dropped by the operation are either freed
+// or, with keepLeftovers, handed back to other (as merge does). A tree
+// combined with itself only changes under difference, which empties it.
+template <class Key, class T>
+void BinaryTree<Key, T>::combine(BinaryTree &other, SetOperation operation,
+                                 bool multi, bool parallel,
+                                 bool keepLeftovers) {
+  if (this == &other) {
+    if (operation == SetOperation::kDifference) clear();
+    return;
+  }
+
+  Group leftovers;
+  size_type dropped = 0;
+  int depth = parallel ? parallelDepth() : 0;
+  Subtree result = combineTrees(Subtree{root_, blackHeight(root_)},
+                                Subtree{other.root_, blackHeight(other.root_)},
+                                operation, multi, depth,
+                                keepLeftovers ? &leftovers : nullptr, dropped);
+
+  nodeCount_ = nodeCount_ + other.nodeCount_ - dropped - leftovers.count;
+  root_ = result.root;
+  other.root_ = buildTree(leftovers).root;
+  other.nodeCount_ = leftovers.count;
+}
+
+// Splits first by the root key of second and recurses on both halves, which
+// takes O(m log(n / m + 1)) for trees of sizes m <= n.
 template <class Key, class T>
-void BinaryTree<Key, T>::mergeTree(Node *node, BinaryTree<Key, T> *other,
-                                   BinaryTree<Key, T> *tmp, bool multi) {
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::combineTrees(
+    Subtree first, Subtree second, SetOperation operation, bool multi,
+    int depth, Group *leftovers, size_type &dropped) {
+  if (!first.root) {
+    if (operation == SetOperation::kUnion || operation == SetOperation::kSum)
+      return second;
+    dropped += deleteTree(second.root);
+    return Subtree();
+  }
+  if (!second.root) {
+    if (operation != SetOperation::kIntersection) return first;
+    dropped += deleteTree(first.root);
+    return Subtree();
+  }
+
+  if ((operation == SetOperation::kUnion || operation == SetOperation::kSum) &&
+      !second.root->getLeft() && !second.root->getRight()) {
+    return insertLeaf(first, second.root, operation == SetOperation::kSum,
+                      leftovers, dropped);
+  }
+
+  bool spawn = depth > 0 &&
+               std::min(first.blackHeight, second.blackHeight) >=
+                   kParallelBlackHeight;
+  const Key &key = second.root->getKey();
+  SplitResult firstParts = splitTree(first, key, multi);
+  SplitResult secondParts = splitTree(second, key, multi);
+
+  Subtree less;
+  Group lessLeftovers;
+  size_type lessDropped = 0;
+  auto combineLess = [&] {
+    less = combineTrees(firstParts.less, secondParts.less, operation, multi,
+                        depth - 1, leftovers ? &lessLeftovers : nullptr,
+                        lessDropped);
+  };
+  std::thread worker;
+  if (spawn) {
+    worker = std::thread(combineLess);
+  } else {
+    combineLess();
+  }
+  Group greaterLeftovers;
+  Subtree greater = combineTrees(
+      firstParts.greater, secondParts.greater, operation, multi, depth - 1,
+      leftovers ? &greaterLeftovers : nullptr, dropped);
+  if (worker.joinable()) worker.join();
+  dropped += lessDropped;
+
+  size_type firstCount = firstParts.equal.count;
+  size_type secondCount = secondParts.equal.count;
+  size_type keepFirst = firstCount;
+  size_type keepSecond = 0;
+  switch (operation) {
+    case SetOperation::kUnion:
+      keepSecond = secondCount > firstCount ? secondCount - firstCount : 0;
+      break;
+    case SetOperation::kSum:
+      keepSecond = secondCount;
+      break;
+    case SetOperation::kIntersection:
+      keepFirst = std::min(firstCount, secondCount);
+      break;
+    case SetOperation::kDifference:
+      keepFirst = firstCount > secondCount ? firstCount - secondCount : 0;
+      break;
+  }
+  Group middle = takeFront(firstParts.equal, keepFirst);
+  appendGroup(middle, takeFront(secondParts.equal, keepSecond));
+  dropped += deleteGroup(firstParts.equal);
+  if (leftovers) {
+    appendGroup(*leftovers, lessLeftovers);
+    appendGroup(*leftovers, secondParts.equal);
+    appendGroup(*leftovers, greaterLeftovers);
+  } else {
+    dropped += deleteGroup(secondParts.equal);
+  }
+
+  if (!middle.first) return joinTrees(less, greater);
+  Node *node = takeFront(middle, 1).first;
+  return joinTrees(less, node, joinTrees(buildTree(middle), greater));
+}
+
+// Adds a lone node to tree, which is cheaper than splitting tree around it
+// and is the common last step of a union. Without multi a node whose key is
+// already present is dropped instead.
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::insertLeaf(
+    Subtree tree, Node *node, bool multi, Group *leftovers,
+    size_type &dropped) {
+  BinaryTree tmp;
+  tmp.root_ = tree.root;
+  if (!multi && tmp.findNode(node->getKey())) {
+    tmp.root_ = nullptr;
+    if (leftovers) {
+      appendGroup(*leftovers, makeGroup(node));
+    } else {
+      delete node;
+      ++dropped;
+    }
+    return tree;
+  }
+
+  Node *current = tree.root;
+  Node *parent = nullptr;
+  while (current) {
+    parent = current;
+    current = (node->getKey() < current->getKey()) ? current->getLeft()
+                                                   : current->getRight();
+  }
+  node->setColor('r');
+  tmp.setChildToParent(node, parent,
+                       parent && node->getKey() < parent->getKey());
+  tmp.insertBalancing(node);
+
+  Subtree result{tmp.root_, blackHeight(tmp.root_)};
+  tmp.root_ = nullptr;
+  return result;
+}
+
+// Returns the keys of tree less than, equal to and greater than key. Without
+// multi the search stops at the first equal key.
+template <class Key, class T>
+typename BinaryTree<Key, T>::SplitResult BinaryTree<Key, T>::splitTree(
+    Subtree tree, const Key &key, bool multi) {
+  SplitResult result;
+  Node *node = tree.root;
+  if (!node) return result;
+
+  Subtree left = detachChild(node->getLeft(), tree.blackHeight - 1);
+  Subtree right = detachChild(node->getRight(), tree.blackHeight - 1);
+  if (key < node->getKey()) {
+    result = splitTree(left, key, multi);
+    result.greater = joinTrees(result.greater, node, right);
+  } else if (node->getKey() < key) {
+    result = splitTree(right, key, multi);
+    result.less = joinTrees(left, node, result.less);
+  } else if (!multi) {
+    result.less = left;
+    result.equal = makeGroup(node);
+    result.greater = right;
+  } else {
+    SplitResult lower = splitTree(left, key, multi);
+    result = splitTree(right, key, multi);
+    result.less = lower.less;
+    appendGroup(lower.equal, makeGroup(node));
+    appendGroup(lower.equal, result.equal);
+    result.equal = lower.equal;
+  }
+  return result;
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::splitLast(
+    Subtree tree, Node *&last) {
+  Node *node = tree.root;
+  Subtree left = detachChild(node->getLeft(), tree.blackHeight - 1);
+  Subtree right = detachChild(node->getRight(), tree.blackHeight - 1);
+  if (!right.root) {
+    last = node;
+    return left;
+  }
+  Subtree rest = splitLast(right, last);
+  return joinTrees(left, node, rest);
+}
+
+// Joins two trees with all keys of left not greater than node and all keys
+// of right not less. The node is hung on the spine of the taller tree at the
+// black height of the shorter one and rebalanced as a fresh insertion, which
+// costs O(|difference of black heights| + 1).
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::joinTrees(
+    Subtree left, Node *node, Subtree right) {
+  node->setParent(nullptr);
+  if (left.blackHeight == right.blackHeight) {
+    node->setColor('b');
+    node->setLeft(left.root);
+    node->setRight(right.root);
+    if (left.root) left.root->setParent(node);
+    if (right.root) right.root->setParent(node);
+    return Subtree{node, left.blackHeight + 1};
+  }
+
+  bool toRight = left.blackHeight > right.blackHeight;
+  const Subtree &taller = toRight ? left : right;
+  const Subtree &shorter = toRight ? right : left;
+  BinaryTree tmp;
+  tmp.root_ = taller.root;
+
+  Node *parent = nullptr;
+  Node *current = taller.root;
+  int height = taller.blackHeight;
+  while (height != shorter.blackHeight || tmp.isRed(current)) {
+    if (tmp.isBlack(current)) --height;
+    parent = current;
+    current = toRight ? current->getRight() : current->getLeft();
+  }
+
+  node->setColor('r');
+  node->setLeft(toRight ? current : left.root);
+  node->setRight(toRight ? right.root : current);
+  if (node->getLeft()) node->getLeft()->setParent(node);
+  if (node->getRight()) node->getRight()->setParent(node);
+  tmp.setChildToParent(node, parent, !toRight);
+  tmp.insertBalancing(node);
+
+  // The shorter tree stays intact on the outer spine, so counting the black
+  // nodes above it gives the new black height.
+  Subtree result{tmp.root_, shorter.blackHeight};
+  for (Node *spine = tmp.root_; spine != shorter.root;
+       spine = toRight ? spine->getRight() : spine->getLeft()) {
+    if (tmp.isBlack(spine)) ++result.blackHeight;
+  }
+  tmp.root_ = nullptr;
+  return result;
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::joinTrees(
+    Subtree left, Subtree right) {
+  if (!left.root) return right;
+  if (!right.root) return left;
+
+  Node *last = nullptr;
+  Subtree rest = splitLast(left, last);
+  return joinTrees(rest, last, right);
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::detachChild(
+    Node *child, int blackHeight) {
+  Subtree tree{child, blackHeight};
+  if (child) {
+    child->setParent(nullptr);
+    if (child->getColor() == 'r') {
+      child->setColor('b');
+      ++tree.blackHeight;
+    }
+  }
+  return tree;
+}
+
+// The nodes are hung on a tree balanced by size, whose leaves lie on at most
+// two levels, so coloring the deepest level red makes it a red-black tree.
+// Takes O(n), unlike joining the nodes one by one.
+template <class Key, class T>
+typename BinaryTree<Key, T>::Subtree BinaryTree<Key, T>::buildTree(
+    Group group) {
+  if (!group.count) return Subtree();
+  int height = 0;
+  while (group.count >> (height + 1)) ++height;
+  Node *chain = group.first;
+  Node *root = buildBalanced(chain, group.count, 0, height);
+  root->setParent(nullptr);
+  return Subtree{root, height ? height : 1};
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Node *BinaryTree<Key, T>::buildBalanced(
+    Node *&chain, size_type count, int depth, int redDepth) {
+  if (!count) return nullptr;
+  Node *left = buildBalanced(chain, count / 2, depth + 1, redDepth);
+  Node *node = chain;
+  chain = node->getRight();
+  Node *right =
+      buildBalanced(chain, count - count / 2 - 1, depth + 1, redDepth);
+  node->setLeft(left);
+  node->setRight(right);
+  if (left) left->setParent(node);
+  if (right) right->setParent(node);
+  node->setColor(depth && depth == redDepth ? 'r' : 'b');
+  return node;
+}
+
+// Appends the nodes of the subtree to group in key order.
+template <class Key, class T>
+void BinaryTree<Key, T>::flattenTree(Node *node, Group &group) {
   if (!node) return;
+  flattenTree(node->getLeft(), group);
+  Node *right = node->getRight();
+  appendGroup(group, makeGroup(node));
+  flattenTree(right, group);
+}
 
-  mergeTree(node->getLeft(), other, tmp, multi);
-  mergeTree(node->getRight(), other, tmp, multi);
-  if (multi || !contains(node->getKey())) {
-    insertToTree(node->getKey(), node->getValue(), multi);
+template <class Key, class T>
+int BinaryTree<Key, T>::blackHeight(Node *node) {
+  int height = 0;
+  for (; node; node = node->getLeft()) {
+    if (node->getColor() == 'b') ++height;
+  }
+  return height;
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Group BinaryTree<Key, T>::makeGroup(Node *node) {
+  node->setLeft(nullptr);
+  node->setRight(nullptr);
+  return Group{node, node, 1};
+}
+
+template <class Key, class T>
+void BinaryTree<Key, T>::appendGroup(Group &group, Group other) {
+  if (!other.first) return;
+  if (group.last) {
+    group.last->setRight(other.first);
   } else {
-    tmp->insertToTree(node->getKey(), node->getValue(), multi);
+    group.first = other.first;
+  }
+  group.last = other.last;
+  group.count += other.count;
+}
+
+template <class Key, class T>
+typename BinaryTree<Key, T>::Group BinaryTree<Key, T>::takeFront(
+    Group &group, size_type count) {
+  Group front;
+  while (front.count < count) {
+    Node *node = group.first;
+    group.first = node->getRight();
+    appendGroup(front, makeGroup(node));
+  }
+  group.count -= count;
+  if (!group.first) group.last = nullptr;
+  return front;
+}
+
+template <class Key, class T>
+size_t BinaryTree<Key, T>::deleteGroup(Group group) {
+  for (Node *node = group.first; node;) {
+    Node *next = node->getRight();
+    delete node;
+    node = next;
+  }
+  return group.count;
+}
+
+template <class Key, class T>
+size_t BinaryTree<Key, T>::deleteTree(Node *node) {
+  if (!node) return 0;
+
+  size_type count = deleteTree(node->getLeft()) + deleteTree(node->getRight());
+  delete node;
+  return count + 1;
+}
+
+// Walks both trees in step, so only the smaller one is traversed in full.
+template <class Key, class T>
+size_t BinaryTree<Key, T>::countFirst(Node *first, Node *second,
+                                      size_type total) {
+  BinaryTree tmp;
+  for (; first && first->getLeft(); first = first->getLeft()) {
+  }
+  for (; second && second->getLeft(); second = second->getLeft()) {
   }
+
+  size_type count = 0;
+  while (first && second) {
+    first = tmp.getNextNode(first);
+    second = tmp.getNextNode(second);
+    ++count;
+  }
+  return first ? total - count : count;
 }
 
 template <class Key, class T>
@@ -564,46 +1080,56 @@ class BinaryTree<Key, T>::Node {
 
   Node() = delete;
   Node(key_type key) : Node(key, key) {}
-  Node(key_type key, value_type value)
-      : pair_(new std::pair<key_type, value_type>(key, value)) {}
-  Node(const Node &other) : Node(other.key_, other.value_) {}
-  Node(Node &&other) noexcept : Node(other.key_, other.value_) {}
-  ~Node() { delete pair_; }
+  Node(key_type key, value_type value) : pair_(key, value) {}
+  Node(const Node &other) : Node(other.getKey(), other.getValue()) {}
+  Node(Node &&other) noexcept : Node(other.getKey(), other.getValue()) {}
+  ~Node() = default;
 
   Node &operator=(const Node &other);
   Node &operator=(Node &&other);
 
   Node *getLeft() const { return left_; }
   Node *getRight() const { return right_; }
-  Node *getParent() const { return parent_; }
-  key_type &getKey() const { return pair_->first; }
-  value_type &getValue() const { return pair_->second; }
-  char getColor() const { return color_; }
-  std::pair<key_type, value_type> *getPair() const { return pair_; }
-  Node *grandpa() { return (parent_) ? parent_->parent_ : nullptr; }
+  Node *getParent() const {
+    return reinterpret_cast<Node *>(parentColor_ & ~kBlackBit);
+  }
+  key_type &getKey() { return pair_.first; }
+  const key_type &getKey() const { return pair_.first; }
+  value_type &getValue() { return pair_.second; }
+  const value_type &getValue() const { return pair_.second; }
+  char getColor() const { return (parentColor_ & kBlackBit) ? 'b' : 'r'; }
+  std::pair<key_type, value_type> *getPair() { return &pair_; }
+  Node *grandpa() { return (getParent()) ? getParent()->getParent() : nullptr; }
   Node *getUncle();
   Node *getBrother();
 
   void setLeft(Node *node) { left_ = node; }
   void setRight(Node *node) { right_ = node; }
-  void setParent(Node *node) { parent_ = node; }
-  void setKey(key_type key) { pair_->first = key; }
-  void setValue(value_type value) { pair_->second = value; }
-  void setColor(char color) { color_ = color; }
+  void setParent(Node *node) {
+    parentColor_ =
+        reinterpret_cast<std::uintptr_t>(node) | (parentColor_ & kBlackBit);
+  }
+  void setKey(key_type key) { pair_.first = key; }
+  void setValue(value_type value) { pair_.second = value; }
+  void setColor(char color) {
+    parentColor_ = (parentColor_ & ~kBlackBit) | (color == 'b' ? kBlackBit : 0);
+  }
 
  private:
-  Node *parent_ = nullptr;
+  // Nodes are at least pointer-aligned, so the lowest bit of the parent
+  // address is always zero and stores the color instead (set = black).
+  static constexpr std::uintptr_t kBlackBit = 1;
+
   Node *left_ = nullptr;
   Node *right_ = nullptr;
-  std::pair<key_type, value_type> *pair_ = nullptr;
-  char color_ = 'r';
+  std::uintptr_t parentColor_ = 0;
+  std::pair<key_type, value_type> pair_;
 };  // class Node
 
 template <class Key, class T>
 typename BinaryTree<Key, T>::Node &BinaryTree<Key, T>::Node::operator=(
     const Node &other) {
-  Node tmp(other);
-  std::swap(pair_, tmp.pair_);
+  pair_ = other.pair_;
   return *this;
 }
 
@@ -617,13 +1143,15 @@ typename BinaryTree<Key, T>::Node &BinaryTree<Key, T>::Node::operator=(
 template <class Key, class T>
 typename BinaryTree<Key, T>::Node *BinaryTree<Key, T>::Node::getUncle() {
   if (!grandpa()) return nullptr;
-  return (parent_ == grandpa()->left_) ? grandpa()->right_ : grandpa()->left_;
+  return (getParent() == grandpa()->left_) ? grandpa()->right_
+                                           : grandpa()->left_;
 }
 
 template <class Key, class T>
 typename BinaryTree<Key, T>::Node *BinaryTree<Key, T>::Node::getBrother() {
-  if (!parent_) return nullptr;
-  return (parent_->left_ == this) ? parent_->right_ : parent_->left_;
+  Node *parent = getParent();
+  if (!parent) return nullptr;
+  return (parent->left_ == this) ? parent->right_ : parent->left_;
 }
 
 template <class Key, class T>
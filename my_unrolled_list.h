@@ -0,0 +1,627 @@
+#ifndef MY_CONTAINERS_MY_UNROLLED_LIST_H
+#define MY_CONTAINERS_MY_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace mycontainers {
+
+// Doubly linked list of blocks holding up to B elements each. Elements of a
+// block are contiguous, so a scan touches one node per B elements and the
+// two links are shared by the whole block. A block keeps its elements in
+// [begin_, end_) of its storage, so both ends of the list grow and shrink
+// in O(1); inserting or erasing inside a block shifts at most B elements.
+// Unlike list, insert and erase invalidate iterators into the affected
+// block.
+template <class T, std::size_t B = 32>
+class unrolled_list {
+  static_assert(B > 0, "unrolled_list needs room for one element per block");
+
+  struct BlockLinks;
+  struct Block;
+
+ public:
+  class UnrolledListConstIterator;
+  class UnrolledListIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledListIterator;
+  using const_iterator = UnrolledListConstIterator;
+  using size_type = size_t;
+
+  unrolled_list() = default;
+  unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const &items);
+  unrolled_list(const unrolled_list &l);
+  unrolled_list(unrolled_list &&l) noexcept;
+  ~unrolled_list() { clear(); }
+
+  unrolled_list &operator=(const unrolled_list &l);
+  unrolled_list &operator=(unrolled_list &&l) noexcept;
+
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *--end(); }
+  const_reference back() const { return *--end(); }
+
+  iterator begin() const;
+  iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value) {
+    return insertValue(pos, value);
+  }
+  iterator insert(const_iterator pos, value_type &&value) {
+    return insertValue(pos, std::move(value));
+  }
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value) { pushBack(value); }
+  void push_back(value_type &&value) { pushBack(std::move(value)); }
+  void pop_back();
+  void push_front(const_reference value) { pushFront(value); }
+  void push_front(value_type &&value) { pushFront(std::move(value)); }
+  void pop_front();
+  void swap(unrolled_list &other);
+  void merge(unrolled_list &other);
+  void splice(const_iterator pos, unrolled_list &other);
+  void reverse();
+  void unique();
+  void sort();
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  Block *first() const { return static_cast<Block *>(sentinel_.next_); }
+  Block *last() const { return static_cast<Block *>(sentinel_.prev_); }
+  template <class Value>
+  iterator insertValue(const_iterator pos, Value &&value);
+  template <class Value>
+  void pushBack(Value &&value);
+  template <class Value>
+  void pushFront(Value &&value);
+  Block *linkBlock(BlockLinks *next, size_type start);
+  void freeBlock(Block *block);
+  Block *splitBlock(Block *block, size_type index);
+  iterator mergeNext(Block *block, iterator pos);
+  void relinkSentinel();
+
+  BlockLinks sentinel_;
+  size_type size_ = 0;
+};  // class unrolled_list
+
+// The list is circular through sentinel_, which holds no elements.
+template <class T, std::size_t B>
+struct unrolled_list<T, B>::BlockLinks {
+  BlockLinks() : prev_(this), next_(this) {}
+
+  size_type count() const { return end_ - begin_; }
+
+  BlockLinks *prev_;
+  BlockLinks *next_;
+  size_type begin_ = 0;
+  size_type end_ = 0;
+};  // struct BlockLinks
+
+template <class T, std::size_t B>
+struct unrolled_list<T, B>::Block : BlockLinks {
+  T *data() { return std::launder(reinterpret_cast<T *>(storage_)); }
+
+  alignas(T) unsigned char storage_[B * sizeof(T)];
+};  // struct Block
+
+template <class T, std::size_t B>
+class unrolled_list<T, B>::UnrolledListConstIterator {
+ public:
+  UnrolledListConstIterator() = default;
+  UnrolledListConstIterator(BlockLinks *block, size_type index)
+      : block_(block), index_(index) {}
+
+  const T &operator*() const { return get(); }
+  const T *operator->() const { return &get(); }
+
+  UnrolledListConstIterator operator++();
+  UnrolledListConstIterator operator--();
+  bool operator==(const UnrolledListConstIterator &it) const {
+    return block_ == it.block_ && index_ == it.index_;
+  }
+  bool operator!=(const UnrolledListConstIterator &it) const {
+    return !(*this == it);
+  }
+
+ protected:
+  friend class unrolled_list;
+
+  T &get() const { return static_cast<Block *>(block_)->data()[index_]; }
+  void next();
+  void prev();
+
+  BlockLinks *block_ = nullptr;
+  size_type index_ = 0;
+};  // class UnrolledListConstIterator
+
+template <class T, std::size_t B>
+class unrolled_list<T, B>::UnrolledListIterator
+    : public UnrolledListConstIterator {
+ public:
+  UnrolledListIterator() = default;
+  UnrolledListIterator(BlockLinks *block, size_type index)
+      : UnrolledListConstIterator(block, index) {}
+
+  T &operator*() const { return this->get(); }
+  T *operator->() const { return &this->get(); }
+
+  UnrolledListIterator operator++() {
+    this->next();
+    return *this;
+  }
+  UnrolledListIterator operator--() {
+    this->prev();
+    return *this;
+  }
+};  // class UnrolledListIterator
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::UnrolledListConstIterator::next() {
+  if (++index_ == block_->end_) {
+    block_ = block_->next_;
+    index_ = block_->begin_;
+  }
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::UnrolledListConstIterator::prev() {
+  if (index_ == block_->begin_) {
+    block_ = block_->prev_;
+    index_ = block_->end_;
+  }
+  --index_;
+}
+
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::UnrolledListConstIterator
+unrolled_list<T, B>::UnrolledListConstIterator::operator++() {
+  next();
+  return *this;
+}
+
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::UnrolledListConstIterator
+unrolled_list<T, B>::UnrolledListConstIterator::operator--() {
+  prev();
+  return *this;
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B>::unrolled_list(size_type n) {
+  for (size_type i = 0; i < n; ++i) {
+    push_back(T());
+  }
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B>::unrolled_list(
+    std::initializer_list<value_type> const &items) {
+  for (auto &item : items) {
+    push_back(item);
+  }
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B>::unrolled_list(const unrolled_list &l) {
+  for (const_iterator it = l.begin(); it != l.end(); ++it) {
+    push_back(*it);
+  }
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B>::unrolled_list(unrolled_list &&l) noexcept {
+  swap(l);
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B> &unrolled_list<T, B>::operator=(const unrolled_list &l) {
+  if (this == &l) return *this;
+  unrolled_list tmp(l);
+  swap(tmp);
+  return *this;
+}
+
+template <class T, std::size_t B>
+unrolled_list<T, B> &unrolled_list<T, B>::operator=(
+    unrolled_list &&l) noexcept {
+  swap(l);
+  return *this;
+}
+
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::begin() const {
+  return iterator(sentinel_.next_, sentinel_.next_->begin_);
+}
+
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::end() const {
+  return iterator(const_cast<BlockLinks *>(&sentinel_), 0);
+}
+
+template <class T, std::size_t B>
+size_t unrolled_list<T, B>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Block) * B / 2;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::clear() {
+  while (size_) {
+    Block *block = first();
+    for (size_type i = block->begin_; i < block->end_; ++i) {
+      block->data()[i].~T();
+    }
+    size_ -= block->count();
+    freeBlock(block);
+  }
+}
+
+// The value may live in this very block, so it is copied or moved out
+// before the block is split or shifted.
+template <class T, std::size_t B>
+template <class Value>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::insertValue(
+    const_iterator pos, Value &&value) {
+  if (pos.block_ == &sentinel_) {
+    pushBack(std::forward<Value>(value));
+    return iterator(last(), last()->end_ - 1);
+  }
+
+  T copy(std::forward<Value>(value));
+  Block *block = static_cast<Block *>(pos.block_);
+  size_type index = pos.index_;
+  if (block->count() == B) {
+    Block *upper = splitBlock(block, B / 2);
+    if (index > block->end_) {
+      index -= block->end_ - upper->begin_;
+      block = upper;
+    }
+  }
+
+  T *data = block->data();
+  if (block->end_ < B) {
+    if (index == block->end_) {
+      new (data + index) T(std::move(copy));
+    } else {
+      new (data + block->end_) T(std::move(data[block->end_ - 1]));
+      std::move_backward(data + index, data + block->end_ - 1,
+                         data + block->end_);
+      data[index] = std::move(copy);
+    }
+    ++block->end_;
+  } else {
+    if (index == block->begin_) {
+      new (data + index - 1) T(std::move(copy));
+    } else {
+      new (data + block->begin_ - 1) T(std::move(data[block->begin_]));
+      std::move(data + block->begin_ + 1, data + index,
+                data + block->begin_);
+      data[index - 1] = std::move(copy);
+    }
+    --block->begin_;
+    --index;
+  }
+  ++size_;
+  return iterator(block, index);
+}
+
+// Shifts the shorter side of the block over the erased element, and merges
+// the block with its successor once both fit in half a block.
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::erase(
+    const_iterator pos) {
+  Block *block = static_cast<Block *>(pos.block_);
+  size_type index = pos.index_;
+  T *data = block->data();
+  if (index - block->begin_ < block->end_ - 1 - index) {
+    std::move_backward(data + block->begin_, data + index, data + index + 1);
+    data[block->begin_].~T();
+    ++block->begin_;
+    ++index;
+  } else {
+    std::move(data + index + 1, data + block->end_, data + index);
+    data[block->end_ - 1].~T();
+    --block->end_;
+  }
+  --size_;
+
+  iterator next(block, index);
+  if (!block->count()) {
+    next = iterator(block->next_, block->next_->begin_);
+    freeBlock(block);
+    return next;
+  }
+  if (index == block->end_) next = iterator(block->next_, block->next_->begin_);
+  return mergeNext(block, next);
+}
+
+template <class T, std::size_t B>
+template <class Value>
+void unrolled_list<T, B>::pushBack(Value &&value) {
+  Block *block = last();
+  if (!size_ || block->end_ == B) {
+    block = linkBlock(&sentinel_, 0);
+    try {
+      new (block->data()) T(std::forward<Value>(value));
+    } catch (...) {
+      freeBlock(block);
+      throw;
+    }
+  } else {
+    new (block->data() + block->end_) T(std::forward<Value>(value));
+  }
+  ++block->end_;
+  ++size_;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::pop_back() {
+  if (!size_) return;
+  Block *block = last();
+  block->data()[--block->end_].~T();
+  --size_;
+  if (!block->count()) freeBlock(block);
+}
+
+template <class T, std::size_t B>
+template <class Value>
+void unrolled_list<T, B>::pushFront(Value &&value) {
+  Block *block = first();
+  if (!size_ || block->begin_ == 0) {
+    block = linkBlock(sentinel_.next_, B);
+    try {
+      new (block->data() + B - 1) T(std::forward<Value>(value));
+    } catch (...) {
+      freeBlock(block);
+      throw;
+    }
+  } else {
+    new (block->data() + block->begin_ - 1) T(std::forward<Value>(value));
+  }
+  --block->begin_;
+  ++size_;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::pop_front() {
+  if (!size_) return;
+  Block *block = first();
+  block->data()[block->begin_++].~T();
+  --size_;
+  if (!block->count()) freeBlock(block);
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::swap(unrolled_list &other) {
+  std::swap(sentinel_.prev_, other.sentinel_.prev_);
+  std::swap(sentinel_.next_, other.sentinel_.next_);
+  std::swap(size_, other.size_);
+  relinkSentinel();
+  other.relinkSentinel();
+}
+
+// Stable: of equal elements, those of this list come first.
+template <class T, std::size_t B>
+void unrolled_list<T, B>::merge(unrolled_list &other) {
+  if (this == &other) return;
+  unrolled_list result;
+  iterator fir = begin();
+  iterator sec = other.begin();
+  while (fir != end() && sec != other.end()) {
+    if (*sec < *fir) {
+      result.push_back(std::move(*sec));
+      ++sec;
+    } else {
+      result.push_back(std::move(*fir));
+      ++fir;
+    }
+  }
+  for (; fir != end(); ++fir) result.push_back(std::move(*fir));
+  for (; sec != other.end(); ++sec) result.push_back(std::move(*sec));
+  swap(result);
+  other.clear();
+}
+
+// Whole blocks of other are relinked; only the block holding pos is split.
+template <class T, std::size_t B>
+void unrolled_list<T, B>::splice(const_iterator pos, unrolled_list &other) {
+  if (this == &other || !other.size_) return;
+
+  BlockLinks *next = pos.block_;
+  if (next != &sentinel_ && pos.index_ != next->begin_) {
+    next = splitBlock(static_cast<Block *>(next), pos.index_);
+  }
+  BlockLinks *prev = next->prev_;
+  prev->next_ = other.sentinel_.next_;
+  other.sentinel_.next_->prev_ = prev;
+  next->prev_ = other.sentinel_.prev_;
+  other.sentinel_.prev_->next_ = next;
+  size_ += other.size_;
+
+  other.sentinel_.next_ = other.sentinel_.prev_ = &other.sentinel_;
+  other.size_ = 0;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::reverse() {
+  BlockLinks *block = &sentinel_;
+  do {
+    std::swap(block->prev_, block->next_);
+    if (block != &sentinel_) {
+      Block *full = static_cast<Block *>(block);
+      std::reverse(full->data() + full->begin_, full->data() + full->end_);
+    }
+    block = block->prev_;
+  } while (block != &sentinel_);
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::unique() {
+  if (size_ <= 1) return;
+  iterator write = begin();
+  iterator read = begin();
+  size_type kept = 1;
+  for (++read; read != end(); ++read) {
+    if (!(*read == *write)) {
+      ++write;
+      if (write != read) *write = std::move(*read);
+      ++kept;
+    }
+  }
+  while (size_ > kept) {
+    pop_back();
+  }
+}
+
+// Bottom-up merge sort on lists: runs of 1, 2, 4, ... elements wait in
+// runs[i] and are merged whenever two of a size meet, so each element is
+// moved O(log n) times and no random-access buffer is needed. runs[i]
+// always holds elements taken before those it is merged with, which keeps
+// the stable merge() stable here.
+template <class T, std::size_t B>
+void unrolled_list<T, B>::sort() {
+  if (size_ <= 1) return;
+  unrolled_list carry;
+  unrolled_list runs[64];
+  int filled = 0;
+  while (size_) {
+    carry.push_back(std::move(front()));
+    pop_front();
+    int i = 0;
+    for (; i < filled && runs[i].size_; ++i) {
+      runs[i].merge(carry);
+      carry.swap(runs[i]);
+    }
+    carry.swap(runs[i]);
+    if (i == filled) ++filled;
+  }
+  for (int i = 1; i < filled; ++i) runs[i].merge(runs[i - 1]);
+  swap(runs[filled - 1]);
+}
+
+template <class T, std::size_t B>
+template <typename... Args>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::insert_many(
+    const_iterator pos, Args &&...args) {
+  iterator inserted(pos.block_, pos.index_);
+  const_iterator next = pos;
+  ((inserted = insert(next, std::forward<Args>(args)), next = inserted,
+    ++next),
+   ...);
+  return inserted;
+}
+
+template <class T, std::size_t B>
+template <typename... Args>
+void unrolled_list<T, B>::insert_many_back(Args &&...args) {
+  (push_back(std::forward<Args>(args)), ...);
+}
+
+template <class T, std::size_t B>
+template <typename... Args>
+void unrolled_list<T, B>::insert_many_front(Args &&...args) {
+  insert_many(begin(), std::forward<Args>(args)...);
+}
+
+// Links an empty block before next whose elements will grow from start.
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::Block *unrolled_list<T, B>::linkBlock(
+    BlockLinks *next, size_type start) {
+  Block *block = new Block;
+  block->begin_ = block->end_ = start;
+  block->next_ = next;
+  block->prev_ = next->prev_;
+  next->prev_->next_ = block;
+  next->prev_ = block;
+  return block;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::freeBlock(Block *block) {
+  block->prev_->next_ = block->next_;
+  block->next_->prev_ = block->prev_;
+  delete block;
+}
+
+// Moves the elements from index to the end of block into a new block linked
+// after it and returns that block.
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::Block *unrolled_list<T, B>::splitBlock(
+    Block *block, size_type index) {
+  if (index < block->begin_) index = block->begin_;
+  Block *upper = linkBlock(block->next_, 0);
+  T *from = block->data();
+  T *to = upper->data();
+  for (size_type i = index; i < block->end_; ++i) {
+    new (to + upper->end_++) T(std::move(from[i]));
+    from[i].~T();
+  }
+  block->end_ = index;
+  return upper;
+}
+
+// Pulls the elements of the next block into block when both fit in half a
+// block, keeping pos pointing at the same element.
+template <class T, std::size_t B>
+typename unrolled_list<T, B>::iterator unrolled_list<T, B>::mergeNext(
+    Block *block, iterator pos) {
+  if (block->next_ == &sentinel_) return pos;
+  Block *next = static_cast<Block *>(block->next_);
+  if (block->count() + next->count() > B / 2) return pos;
+
+  T *data = block->data();
+  if (block->end_ + next->count() > B) {
+    size_type shift = block->begin_;
+    for (size_type i = block->begin_; i < block->end_; ++i) {
+      new (data + i - shift) T(std::move(data[i]));
+      data[i].~T();
+    }
+    if (pos.block_ == block) pos.index_ -= shift;
+    block->begin_ -= shift;
+    block->end_ -= shift;
+  }
+  if (pos.block_ == next) {
+    pos = iterator(block, block->end_ + pos.index_ - next->begin_);
+  }
+  for (size_type i = next->begin_; i < next->end_; ++i) {
+    new (data + block->end_++) T(std::move(next->data()[i]));
+    next->data()[i].~T();
+  }
+  freeBlock(next);
+  return pos;
+}
+
+template <class T, std::size_t B>
+void unrolled_list<T, B>::relinkSentinel() {
+  if (!size_) {
+    sentinel_.next_ = sentinel_.prev_ = &sentinel_;
+  } else {
+    sentinel_.next_->prev_ = &sentinel_;
+    sentinel_.prev_->next_ = &sentinel_;
+  }
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_UNROLLED_LIST_H
@@ -1,6 +1,28 @@
 #ifndef MY_CONTAINERS_MY_VECTOR_H
 #define MY_CONTAINERS_MY_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Under C++20 the vector is usable in constant expressions: memory
+// allocated there must be freed before the evaluation ends, so a vector can
+// serve as scratch space while computing a table, not hold the result.
+#ifndef MY_CONTAINERS_CONSTEXPR20
+#if __cplusplus >= 202002L
+#define MY_CONTAINERS_CONSTEXPR20 constexpr
+#else
+#define MY_CONTAINERS_CONSTEXPR20
+#endif
+#endif
+
 namespace mycontainers {
 
 template <class T>
@@ -16,48 +38,72 @@ class vector {
   using const_iterator = VectorConstIterator;
   using size_type = size_t;
 
-  vector() noexcept;
-  vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
-  vector(const vector &v);
-  vector(vector &&v) noexcept;
-  ~vector();
-
-  vector &operator=(const vector &v);
-  vector &operator=(vector &&v) noexcept;
-
-  reference at(size_type pos);
-  reference operator[](size_type pos) const;
-  const_reference front() const;
-  const_reference back() const;
-  T *data() noexcept;
-
-  iterator begin() const;
-  iterator end() const;
-  const_iterator cbegin() const;
-  const_iterator cend() const;
-
-  bool empty() const noexcept;
-  inline size_type size() const { return size_; }
-  size_type max_size() const;
-  void reserve(size_type size);
-  inline size_type capacity() const { return capacity_; }
-  void shrink_to_fit();
-
-  void clear() noexcept;
-  iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
-  void push_back(const_reference value);
-  void pop_back();
-  void swap(vector &other);
+  MY_CONTAINERS_CONSTEXPR20 vector() noexcept;
+  MY_CONTAINERS_CONSTEXPR20 vector(size_type n);
+  MY_CONTAINERS_CONSTEXPR20 vector(
+      std::initializer_list<value_type> const &items);
+  MY_CONTAINERS_CONSTEXPR20 vector(const vector &v);
+  MY_CONTAINERS_CONSTEXPR20 vector(vector &&v) noexcept;
+  MY_CONTAINERS_CONSTEXPR20 ~vector();
+
+  MY_CONTAINERS_CONSTEXPR20 vector &operator=(const vector &v);
+  MY_CONTAINERS_CONSTEXPR20 vector &operator=(vector &&v) noexcept;
+
+  MY_CONTAINERS_CONSTEXPR20 reference at(size_type pos);
+  MY_CONTAINERS_CONSTEXPR20 reference operator[](size_type pos) const;
+  MY_CONTAINERS_CONSTEXPR20 reference front();
+  MY_CONTAINERS_CONSTEXPR20 const_reference front() const;
+  MY_CONTAINERS_CONSTEXPR20 reference back();
+  MY_CONTAINERS_CONSTEXPR20 const_reference back() const;
+  MY_CONTAINERS_CONSTEXPR20 T *data() noexcept;
+
+  MY_CONTAINERS_CONSTEXPR20 iterator begin() const;
+  MY_CONTAINERS_CONSTEXPR20 iterator end() const;
+  MY_CONTAINERS_CONSTEXPR20 const_iterator cbegin() const;
+  MY_CONTAINERS_CONSTEXPR20 const_iterator cend() const;
+
+  MY_CONTAINERS_CONSTEXPR20 bool empty() const noexcept;
+  MY_CONTAINERS_CONSTEXPR20 size_type size() const { return size_; }
+  MY_CONTAINERS_CONSTEXPR20 size_type max_size() const;
+  MY_CONTAINERS_CONSTEXPR20 void reserve(size_type size);
+  MY_CONTAINERS_CONSTEXPR20 size_type capacity() const { return capacity_; }
+  MY_CONTAINERS_CONSTEXPR20 void shrink_to_fit();
+
+  MY_CONTAINERS_CONSTEXPR20 void clear() noexcept;
+  MY_CONTAINERS_CONSTEXPR20 iterator insert(iterator pos,
+                                            const_reference value);
+  MY_CONTAINERS_CONSTEXPR20 void erase(iterator pos);
+  MY_CONTAINERS_CONSTEXPR20 void push_back(const_reference value);
+  MY_CONTAINERS_CONSTEXPR20 void push_back(value_type &&value);
+  MY_CONTAINERS_CONSTEXPR20 void pop_back();
+  MY_CONTAINERS_CONSTEXPR20 void swap(vector &other);
+  // The removals below move the kept elements forward in one pass and
+  // return the number of removed ones; capacity is left as it is.
+  MY_CONTAINERS_CONSTEXPR20 size_type remove(const_reference value);
+  template <class Predicate>
+  MY_CONTAINERS_CONSTEXPR20 size_type remove_if(Predicate pred);
+  // Removes every element for which pred(first of its run, element) holds.
+  template <class BinaryPredicate = std::equal_to<T>>
+  MY_CONTAINERS_CONSTEXPR20 size_type unique(
+      BinaryPredicate pred = BinaryPredicate());
 
   template <typename... Args>
-  iterator insert_many(const_iterator pos, Args &&...args);
+  MY_CONTAINERS_CONSTEXPR20 iterator insert_many(const_iterator pos,
+                                                 Args &&...args);
   template <typename... Args>
-  void insert_many_back(Args &&...args);
+  MY_CONTAINERS_CONSTEXPR20 void insert_many_back(Args &&...args);
 
  private:
-  value_type *data_;
+  template <class... Args>
+  static MY_CONTAINERS_CONSTEXPR20 void construct(T *place, Args &&...args);
+  // Moves the elements into new storage for capacity elements.
+  MY_CONTAINERS_CONSTEXPR20 void reallocate(size_type capacity);
+  // Destroys the elements from pos to the end.
+  MY_CONTAINERS_CONSTEXPR20 void destroyFrom(size_type pos) noexcept;
+
+  // Only [0, size_) holds constructed elements; the rest of the capacity
+  // is raw storage.
+  value_type *data_ = nullptr;
   size_type capacity_ = 0;
   size_type size_ = 0;
 };
@@ -65,15 +111,17 @@ class vector {
 template <class T>
 class vector<T>::VectorConstIterator {
  public:
-  VectorConstIterator(){};
-  VectorConstIterator(T *);
-
-  T &operator*();
-  typename vector<T>::VectorConstIterator operator++();
-  typename vector<T>::VectorConstIterator operator--();
-  bool operator==(const VectorConstIterator it);
-  bool operator!=(const VectorConstIterator it);
-  size_type operator-(const VectorConstIterator it);
+  MY_CONTAINERS_CONSTEXPR20 VectorConstIterator(){};
+  MY_CONTAINERS_CONSTEXPR20 VectorConstIterator(T *);
+
+  MY_CONTAINERS_CONSTEXPR20 T &operator*();
+  MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
+  operator++();
+  MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
+  operator--();
+  MY_CONTAINERS_CONSTEXPR20 bool operator==(const VectorConstIterator it);
+  MY_CONTAINERS_CONSTEXPR20 bool operator!=(const VectorConstIterator it);
+  MY_CONTAINERS_CONSTEXPR20 size_type operator-(const VectorConstIterator it);
 
  private:
   const T *ptr_;
@@ -82,15 +130,15 @@ class vector<T>::VectorConstIterator {
 template <class T>
 class vector<T>::VectorIterator {
  public:
-  VectorIterator(){};
-  VectorIterator(T *);
+  MY_CONTAINERS_CONSTEXPR20 VectorIterator(){};
+  MY_CONTAINERS_CONSTEXPR20 VectorIterator(T *);
 
-  T &operator*();
-  typename vector<T>::VectorIterator operator++();
-  typename vector<T>::VectorIterator operator--();
-  bool operator==(const VectorIterator it);
-  bool operator!=(const VectorIterator it);
-  size_type operator-(const VectorIterator it);
+  MY_CONTAINERS_CONSTEXPR20 T &operator*();
+  MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator operator++();
+  MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator operator--();
+  MY_CONTAINERS_CONSTEXPR20 bool operator==(const VectorIterator it);
+  MY_CONTAINERS_CONSTEXPR20 bool operator!=(const VectorIterator it);
+  MY_CONTAINERS_CONSTEXPR20 size_type operator-(const VectorIterator it);
 
  private:
   T *ptr_;
@@ -99,39 +147,44 @@ class vector<T>::VectorIterator {
 // class const_iterator foo begin
 
 template <class T>
-vector<T>::VectorConstIterator::VectorConstIterator(T *p) : ptr_(p) {}
+MY_CONTAINERS_CONSTEXPR20 vector<T>::VectorConstIterator::VectorConstIterator(
+    T *p)
+    : ptr_(p) {}
 
 template <class T>
-T &vector<T>::VectorConstIterator::operator*() {
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::VectorConstIterator::operator*() {
   return *ptr_;
 }
 
 template <class T>
-typename vector<T>::VectorConstIterator
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
 vector<T>::VectorConstIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
 template <class T>
-typename vector<T>::VectorConstIterator
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
 vector<T>::VectorConstIterator::operator--() {
   --ptr_;
   return *this;
 }
 
 template <class T>
-bool vector<T>::VectorConstIterator::operator==(const VectorConstIterator it) {
+MY_CONTAINERS_CONSTEXPR20 bool
+vector<T>::VectorConstIterator::operator==(const VectorConstIterator it) {
   return ptr_ == it.ptr_ ? 1 : 0;
 }
 
 template <class T>
-bool vector<T>::VectorConstIterator::operator!=(const VectorConstIterator it) {
+MY_CONTAINERS_CONSTEXPR20 bool
+vector<T>::VectorConstIterator::operator!=(const VectorConstIterator it) {
   return ptr_ == it.ptr_ ? 0 : 1;
 }
 
 template <class T>
-size_t vector<T>::VectorConstIterator::operator-(const VectorConstIterator it) {
+MY_CONTAINERS_CONSTEXPR20 size_t
+vector<T>::VectorConstIterator::operator-(const VectorConstIterator it) {
   return ptr_ - it.ptr_;
 }
 
@@ -140,37 +193,43 @@ size_t vector<T>::VectorConstIterator::operator-(const VectorConstIterator it) {
 // class iterator foo begin
 
 template <class T>
-vector<T>::VectorIterator::VectorIterator(T *p) : ptr_(p) {}
+MY_CONTAINERS_CONSTEXPR20 vector<T>::VectorIterator::VectorIterator(T *p)
+    : ptr_(p) {}
 
 template <class T>
-T &vector<T>::VectorIterator::operator*() {
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::VectorIterator::operator*() {
   return *ptr_;
 }
 
 template <class T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator++() {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::VectorIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
 template <class T>
-typename vector<T>::VectorIterator vector<T>::VectorIterator::operator--() {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::VectorIterator::operator--() {
   --ptr_;
   return *this;
 }
 
 template <class T>
-bool vector<T>::VectorIterator::operator==(const VectorIterator it) {
+MY_CONTAINERS_CONSTEXPR20 bool
+vector<T>::VectorIterator::operator==(const VectorIterator it) {
   return ptr_ == it.ptr_ ? 1 : 0;
 }
 
 template <class T>
-bool vector<T>::VectorIterator::operator!=(const VectorIterator it) {
+MY_CONTAINERS_CONSTEXPR20 bool
+vector<T>::VectorIterator::operator!=(const VectorIterator it) {
   return ptr_ == it.ptr_ ? 0 : 1;
 }
 
 template <class T>
-size_t vector<T>::VectorIterator::operator-(const VectorIterator it) {
+MY_CONTAINERS_CONSTEXPR20 size_t
+vector<T>::VectorIterator::operator-(const VectorIterator it) {
   return ptr_ - it.ptr_;
   ;
 }
@@ -178,127 +237,183 @@ size_t vector<T>::VectorIterator::operator-(const VectorIterator it) {
 // class iterator foo end
 
 template <class T>
-void vector<T>::swap(vector &other) {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::swap(vector &other) {
   std::swap(data_, other.data_);
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
 }
 
 template <class T>
-typename vector<T>::VectorIterator vector<T>::end() const {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::end() const {
   vector<T>::VectorIterator it(data_ + size_);
   return it;
 }
 
 template <class T>
-typename vector<T>::VectorIterator vector<T>::begin() const {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::begin() const {
   return iterator(data_);
 }
 
 template <class T>
-typename vector<T>::VectorConstIterator vector<T>::cend() const {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
+vector<T>::cend() const {
   vector<T>::VectorConstIterator it(data_ + size_);
   return it;
 }
 
 template <class T>
-typename vector<T>::VectorConstIterator vector<T>::cbegin() const {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorConstIterator
+vector<T>::cbegin() const {
   return const_iterator(data_);
 }
 
 template <class T>
-void vector<T>::pop_back() {
-  size_--;
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::pop_back() {
+  std::destroy_at(data_ + --size_);
 }
 
+// value may be an element, so on growth it is copied before the old
+// storage goes away.
 template <class T>
-void vector<T>::push_back(const_reference value) {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::push_back(const_reference value) {
   if (size_ == capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
+    T copy(value);
+    reallocate(capacity_ ? capacity_ * 2 : 1);
+    construct(data_ + size_, std::move(copy));
+  } else {
+    construct(data_ + size_, value);
   }
-  data_[size_] = value;
   ++size_;
 }
 
 template <class T>
-typename vector<T>::VectorIterator vector<T>::insert(iterator pos,
-                                                     const_reference value) {
-  size_type more = 1;
-  if (size_ == capacity_) more += 1;
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::push_back(value_type &&value) {
+  if (size_ == capacity_) {
+    T copy(std::move(value));
+    reallocate(capacity_ ? capacity_ * 2 : 1);
+    construct(data_ + size_, std::move(copy));
+  } else {
+    construct(data_ + size_, std::move(value));
+  }
+  ++size_;
+}
+
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::insert(iterator pos, const_reference value) {
   size_type n = pos - begin();
-  vector<value_type> tmp(capacity_ * more);
-  size_type fl = 0;
-  for (size_type i = 0; i < size_; ++i) {
-    if (i == n) {
-      tmp.data_[n] = value;
-      ++i;
-      ++size_;
-      fl = 1;
-    }
-    tmp.data_[i] = data_[i - fl];
+  T copy(value);
+  if (size_ == capacity_) reallocate(capacity_ ? capacity_ * 2 : 1);
+  if (n == size_) {
+    construct(data_ + size_, std::move(copy));
+  } else {
+    construct(data_ + size_, std::move(data_[size_ - 1]));
+    std::move_backward(data_ + n, data_ + size_ - 1, data_ + size_);
+    data_[n] = std::move(copy);
   }
-  tmp.size_ = size_;
-  *this = std::move(tmp);
+  ++size_;
   return data_ + n;
 }
 
 template <class T>
-void vector<T>::erase(iterator pos) {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::erase(iterator pos) {
   size_type n = pos - begin();
-  vector<value_type> tmp(size_);
-  size_type fl = 0;
-  for (size_type i = 0; i < size_; ++i) {
-    if (i == n) {
-      size_--;
-      fl = 1;
+  std::move(data_ + n + 1, data_ + size_, data_ + n);
+  pop_back();
+}
+
+// value is copied first if it is an element of the vector, as the
+// compaction overwrites elements while value is still compared.
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::size_type
+vector<T>::remove(const_reference value) {
+#if __cplusplus >= 202002L
+  // Pointers into unrelated objects cannot be compared in a constant
+  // expression, so there the value is always copied.
+  if (std::is_constant_evaluated()) {
+    T copy(value);
+    return remove_if([&copy](const_reference item) { return item == copy; });
+  }
+#endif
+  std::less_equal<const T *> notAfter;
+  if (notAfter(data_, &value) && !notAfter(data_ + size_, &value)) {
+    T copy(value);
+    return remove_if([&copy](const_reference item) { return item == copy; });
+  }
+  return remove_if([&value](const_reference item) { return item == value; });
+}
+
+// If pred throws, the elements not yet examined are kept.
+template <class T>
+template <class Predicate>
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::size_type
+vector<T>::remove_if(Predicate pred) {
+  size_type kept = 0;
+  size_type i = 0;
+  try {
+    for (; i < size_; ++i) {
+      if (pred(data_[i])) continue;
+      if (kept != i) data_[kept] = std::move(data_[i]);
+      ++kept;
     }
-    tmp.data_[i] = data_[i + fl];
+  } catch (...) {
+    for (; i < size_; ++i) data_[kept++] = std::move(data_[i]);
+    destroyFrom(kept);
+    throw;
   }
-  tmp.size_ = size_;
-  *this = std::move(tmp);
+  size_type removed = size_ - kept;
+  destroyFrom(kept);
+  return removed;
 }
 
 template <class T>
-void vector<T>::clear() noexcept {
-  size_ = 0;
+template <class BinaryPredicate>
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::size_type
+vector<T>::unique(BinaryPredicate pred) {
+  if (!size_) return 0;
+  size_type kept = 1;
+  for (size_type i = 1; i < size_; ++i) {
+    if (pred(data_[kept - 1], data_[i])) continue;
+    if (kept != i) data_[kept] = std::move(data_[i]);
+    ++kept;
+  }
+  size_type removed = size_ - kept;
+  destroyFrom(kept);
+  return removed;
 }
 
 template <class T>
-size_t vector<T>::max_size() const {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::clear() noexcept {
+  destroyFrom(0);
+}
+
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 size_t vector<T>::max_size() const {
   return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
 }
 
 template <class T>
-void vector<T>::shrink_to_fit() {
-  vector<value_type> tmp(size_);
-  for (size_type i = 0; i < size_; ++i) {
-    tmp.data_[i] = data_[i];
-  }
-  *this = std::move(tmp);
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::shrink_to_fit() {
+  if (capacity_ > size_) reallocate(size_);
 }
 
 template <class T>
-void vector<T>::reserve(size_type size) {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::reserve(size_type size) {
   if (size > max_size()) {
     throw std::length_error("vector::_M_range_check");
   }
-  if (size > size_) {
-    vector<value_type> tmp(size);
-    for (size_type i = 0; i < size_; ++i) {
-      tmp.data_[i] = data_[i];
-    }
-    tmp.size_ = size_;
-    *this = std::move(tmp);
-  }
+  if (size > capacity_) reallocate(size);
 }
 
 template <class T>
-T *vector<T>::data() noexcept {
+MY_CONTAINERS_CONSTEXPR20 T *vector<T>::data() noexcept {
   return data_;
 }
 
 template <class T>
-const T &vector<T>::back() const {
+MY_CONTAINERS_CONSTEXPR20 const T &vector<T>::back() const {
   if (size_ == 0) {
     throw std::out_of_range("mycontainers::array::range_check");
   };
@@ -306,7 +421,17 @@ const T &vector<T>::back() const {
 }
 
 template <class T>
-const T &vector<T>::front() const {
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::back() {
+  return const_cast<T &>(static_cast<const vector &>(*this).back());
+}
+
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::front() {
+  return const_cast<T &>(static_cast<const vector &>(*this).front());
+}
+
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 const T &vector<T>::front() const {
   if (size_ == 0) {
     throw std::out_of_range("mycontainers::array::range_check");
   };
@@ -314,12 +439,12 @@ const T &vector<T>::front() const {
 }
 
 template <class T>
-T &vector<T>::operator[](size_type pos) const {
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::operator[](size_type pos) const {
   return data_[pos];
 }
 
 template <class T>
-T &vector<T>::at(size_type pos) {
+MY_CONTAINERS_CONSTEXPR20 T &vector<T>::at(size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("vector::_M_range_check");
   };
@@ -327,7 +452,7 @@ T &vector<T>::at(size_type pos) {
 }
 
 template <class T>
-vector<T> &vector<T>::operator=(vector &&v) noexcept {
+MY_CONTAINERS_CONSTEXPR20 vector<T> &vector<T>::operator=(vector &&v) noexcept {
   if (this == &v) return *this;
   std::swap(capacity_, v.capacity_);
   std::swap(size_, v.size_);
@@ -336,96 +461,145 @@ vector<T> &vector<T>::operator=(vector &&v) noexcept {
 }
 
 template <class T>
-vector<T> &vector<T>::operator=(const vector &v) {
+MY_CONTAINERS_CONSTEXPR20 vector<T> &vector<T>::operator=(const vector &v) {
   if (this == &v) return *this;
-  capacity_ = v.capacity_;
-  size_ = v.size_;
-  data_ = new value_type[capacity_];
-  for (size_t i = 0; i < size_; ++i) {
-    data_[i] = v.data_[i];
-  }
+  vector tmp(v);
+  swap(tmp);
   return *this;
 }
 
 template <class T>
-bool vector<T>::empty() const noexcept {
+MY_CONTAINERS_CONSTEXPR20 bool vector<T>::empty() const noexcept {
   return size_ == 0 ? true : false;
 }
 
 template <class T>
-vector<T>::vector() noexcept : capacity_(0), size_(0) {}
+MY_CONTAINERS_CONSTEXPR20 vector<T>::vector() noexcept {}
 
+// The constructors below build into an empty vector, so the destructor of
+// a vector that throws halfway never runs; they clean up themselves.
 template <class T>
-vector<T>::vector(size_type n) : capacity_(n), size_(n) {
-  data_ = new T[n]{};
+MY_CONTAINERS_CONSTEXPR20 vector<T>::vector(size_type n) {
+  reserve(n);
+  try {
+    for (; size_ < n; ++size_) construct(data_ + size_);
+  } catch (...) {
+    this->~vector();
+    throw;
+  }
 }
 
 template <class T>
-vector<T>::vector(std::initializer_list<value_type> const &items)
-    : capacity_(items.size()), size_(items.size()) {
-  data_ = new value_type[capacity_];
-  auto iter = items.begin();
-  for (size_type i = 0; i < size_; ++i) {
-    data_[i] = *(iter + i);
+MY_CONTAINERS_CONSTEXPR20 vector<T>::vector(
+    std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  try {
+    for (const_reference item : items) construct(data_ + size_++, item);
+  } catch (...) {
+    --size_;
+    this->~vector();
+    throw;
   }
 }
 
 template <class T>
-vector<T>::vector(const vector &v) : capacity_(v.capacity_), size_(v.size_) {
-  data_ = new value_type[capacity_];
-  for (size_t i = 0; i < size_; ++i) {
-    data_[i] = v.data_[i];
+MY_CONTAINERS_CONSTEXPR20 vector<T>::vector(const vector &v) {
+  reserve(v.capacity_);
+  try {
+    for (; size_ < v.size_; ++size_) construct(data_ + size_, v.data_[size_]);
+  } catch (...) {
+    this->~vector();
+    throw;
   }
 }
 
 template <class T>
-vector<T>::vector(vector &&v) noexcept {
+MY_CONTAINERS_CONSTEXPR20 vector<T>::vector(vector &&v) noexcept {
   std::swap(size_, v.size_);
   std::swap(capacity_, v.capacity_);
   std::swap(data_, v.data_);
 }
 
 template <class T>
-vector<T>::~vector() {
-  if (capacity_) {
-    delete[] data_;
-  }
+MY_CONTAINERS_CONSTEXPR20 vector<T>::~vector() {
+  destroyFrom(0);
+  if (data_) std::allocator<T>().deallocate(data_, capacity_);
 }
 
+// The new elements are appended and rotated into place, so each element
+// after pos moves once.
 template <class T>
 template <typename... Args>
-typename vector<T>::VectorIterator vector<T>::insert_many(const_iterator pos,
-                                                          Args &&...args) {
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::VectorIterator
+vector<T>::insert_many(const_iterator pos, Args &&...args) {
   if (!sizeof...(args)) return iterator(data_);
-  vector<value_type> many{args...};
   size_type n = pos - cbegin();
-  size_type new_size = size_ + many.size_;
-  if (new_size > capacity_) reserve(new_size);
-  vector<value_type> tmp(size_ - n);
-  for (size_t i = 0; i < tmp.size_; ++i) {
-    tmp.data_[i] = data_[i + n];
-  }
-  for (size_t i = 0; i < many.size_; ++i) {
-    data_[i + n] = many.data_[i];
-  }
-  for (size_t i = 0; i < tmp.size_; ++i) {
-    data_[i + n + many.size_] = tmp.data_[i];
-  }
-  size_ = new_size;
+  size_type old_size = size_;
+  insert_many_back(std::forward<Args>(args)...);
+  std::rotate(data_ + n, data_ + old_size, data_ + size_);
   return iterator(data_);
 }
 
+// The arguments may refer to elements, so they are copied aside before the
+// storage grows.
 template <class T>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::insert_many_back(Args &&...args) {
   if (!sizeof...(args)) return;
-  vector<value_type> many{args...};
+  vector<value_type> many;
+  many.reserve(sizeof...(args));
+  (many.push_back(std::forward<Args>(args)), ...);
   size_type new_size = size_ + many.size_;
   if (new_size > capacity_) reserve(new_size);
-  for (size_t i = 0; i < many.size_; ++i) {
-    data_[i + size_] = many.data_[i];
+  for (size_type i = 0; i < many.size_; ++i) {
+    construct(data_ + size_, std::move(many.data_[i]));
+    ++size_;
   }
-  size_ = new_size;
+}
+
+template <class T>
+template <class... Args>
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::construct(T *place, Args &&...args) {
+#if __cplusplus >= 202002L
+  std::construct_at(place, std::forward<Args>(args)...);
+#else
+  ::new (static_cast<void *>(place)) T(std::forward<Args>(args)...);
+#endif
+}
+
+// Elements are moved unless that may throw and they can be copied, so a
+// failed reallocation leaves the vector as it was.
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::reallocate(size_type capacity) {
+  std::allocator<T> allocator;
+  T *data = capacity ? allocator.allocate(capacity) : nullptr;
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      construct(data + moved, std::move_if_noexcept(data_[moved]));
+    }
+  } catch (...) {
+    while (moved) std::destroy_at(data + --moved);
+    if (data) allocator.deallocate(data, capacity);
+    throw;
+  }
+  size_type size = size_;
+  destroyFrom(0);
+  if (data_) allocator.deallocate(data_, capacity_);
+  data_ = data;
+  capacity_ = capacity;
+  size_ = size;
+}
+
+template <class T>
+MY_CONTAINERS_CONSTEXPR20 void vector<T>::destroyFrom(size_type pos) noexcept {
+  while (size_ > pos) std::destroy_at(data_ + --size_);
+}
+
+template <class T, class Predicate>
+MY_CONTAINERS_CONSTEXPR20 typename vector<T>::size_type erase_if(
+    vector<T> &v, Predicate pred) {
+  return v.remove_if(pred);
 }
 
 }  // namespace mycontainers
@@ -0,0 +1,176 @@
+#ifndef MY_CONTAINERS_MY_WORK_STEALING_DEQUE_H
+#define MY_CONTAINERS_MY_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "my_vector.h"
+
+namespace mycontainers {
+
+// Chase-Lev work-stealing deque (in the C11 formulation of Le et al.). The
+// owning thread pushes and pops at the bottom without locks, LIFO; any
+// other thread steals from the top, FIFO, with a CAS that fails if it
+// races with the owner or another thief. The circular storage doubles when
+// full. A thief may still be reading a replaced buffer, so old buffers are
+// kept until the deque is destroyed; as each is half the size of its
+// successor, together they never take more than the current one.
+//
+// Elements are copied in and out of atomic slots, so T must be trivially
+// copyable, typically a task pointer or a small task descriptor.
+template <class T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "work_stealing_deque stores elements in atomic slots");
+
+  class Buffer;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Rounds capacity up to a power of two.
+  explicit work_stealing_deque(size_type capacity = kDefaultCapacity);
+  work_stealing_deque(const work_stealing_deque &d) = delete;
+  work_stealing_deque(work_stealing_deque &&d) = delete;
+  ~work_stealing_deque();
+
+  work_stealing_deque &operator=(const work_stealing_deque &d) = delete;
+  work_stealing_deque &operator=(work_stealing_deque &&d) = delete;
+
+  // Approximate while other threads steal.
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept {
+    return buffer_.load(std::memory_order_relaxed)->capacity();
+  }
+
+  // Owner thread only.
+  void push(const_reference value);
+  bool pop(reference out);
+  // Any thread; returns false if the deque is empty or the element was
+  // taken by another thread first.
+  bool steal(reference out);
+
+ private:
+  static constexpr size_type kDefaultCapacity = 64;
+  static constexpr size_type kCacheLine = 64;
+
+  Buffer *grow(Buffer *buffer, std::int64_t bottom, std::int64_t top);
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Buffer *> buffer_;
+  // Replaced buffers, touched by the owner only.
+  mycontainers::vector<Buffer *> retired_;
+};  // class work_stealing_deque
+
+template <class T>
+class work_stealing_deque<T>::Buffer {
+ public:
+  explicit Buffer(size_type capacity)
+      : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+
+  size_type capacity() const { return mask_ + 1; }
+  T get(std::int64_t index) const {
+    return slots_[size_type(index) & mask_].load(std::memory_order_relaxed);
+  }
+  void put(std::int64_t index, const T &value) {
+    slots_[size_type(index) & mask_].store(value, std::memory_order_relaxed);
+  }
+
+ private:
+  size_type mask_;
+  std::unique_ptr<std::atomic<T>[]> slots_;
+};  // class Buffer
+
+template <class T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity) {
+  size_type rounded = 1;
+  while (rounded < capacity) rounded *= 2;
+  buffer_.store(new Buffer(rounded), std::memory_order_relaxed);
+}
+
+template <class T>
+work_stealing_deque<T>::~work_stealing_deque() {
+  delete buffer_.load(std::memory_order_relaxed);
+  for (size_type i = 0; i < retired_.size(); ++i) delete retired_[i];
+}
+
+template <class T>
+size_t work_stealing_deque<T>::size() const noexcept {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  return bottom > top ? size_type(bottom - top) : 0;
+}
+
+template <class T>
+void work_stealing_deque<T>::push(const_reference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top >= std::int64_t(buffer->capacity())) {
+    buffer = grow(buffer, bottom, top);
+  }
+  buffer->put(bottom, value);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+// The owner reserves the bottom element before looking at the top; only
+// when it is the last one can a thief be after it too, and the CAS on the
+// top decides.
+template <class T>
+bool work_stealing_deque<T>::pop(reference out) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = buffer->get(bottom);
+  if (top < bottom) return true;
+  bool won = top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+  return won;
+}
+
+template <class T>
+bool work_stealing_deque<T>::steal(reference out) {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return false;
+  Buffer *buffer = buffer_.load(std::memory_order_acquire);
+  T value = buffer->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  out = value;
+  return true;
+}
+
+template <class T>
+typename work_stealing_deque<T>::Buffer *work_stealing_deque<T>::grow(
+    Buffer *buffer, std::int64_t bottom, std::int64_t top) {
+  std::unique_ptr<Buffer> bigger(new Buffer(buffer->capacity() * 2));
+  for (std::int64_t i = top; i < bottom; ++i) bigger->put(i, buffer->get(i));
+  retired_.push_back(buffer);
+  buffer_.store(bigger.get(), std::memory_order_release);
+  return bigger.release();
+}
+
+}  // namespace mycontainers
+
+#endif  // MY_CONTAINERS_MY_WORK_STEALING_DEQUE_H
@@ -1,4 +1,9 @@
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
 #include "../my_array.h"
+#include "../my_vector.h"
 #include "gtest/gtest.h"
 
 TEST(array, constructor) {
@@ -179,4 +184,101 @@ TEST(array, fill) {
   for (size_t i = 0; i < myarray.size(); ++i) {
     ASSERT_EQ(myarray[i], stdarray[i]);
   }
-}
\ No newline at end of file
+}
+
+TEST(array, inline_layout) {
+  using Vec4 = mycontainers::array<float, 4>;
+  static_assert(std::is_aggregate_v<Vec4>);
+  static_assert(std::is_trivially_copyable_v<Vec4>);
+  static_assert(std::is_standard_layout_v<Vec4>);
+  static_assert(sizeof(Vec4) == 4 * sizeof(float));
+  static_assert(alignof(Vec4) == alignof(float));
+  static_assert(!std::is_trivially_copyable_v<
+                mycontainers::array<std::string, 2>>);
+
+  mycontainers::vector<Vec4> points;
+  for (int i = 0; i < 100; ++i) {
+    Vec4 point{float(i), 1, 2, 3};
+    points.push_back(point);
+  }
+  const float *first = points[0].data();
+  for (size_t i = 0; i < points.size(); ++i) {
+    ASSERT_EQ(points[i].data(), first + 4 * i);
+    ASSERT_EQ(points[i][0], float(i));
+    ASSERT_EQ(points[i].back(), 3.0f);
+  }
+}
+
+TEST(array, value_semantics) {
+  mycontainers::array<std::string, 3> myarray{"a", "b"};
+  ASSERT_EQ(myarray[2], "");
+  mycontainers::array<std::string, 3> myarray2 = myarray;
+  myarray2.front() = "z";
+  ASSERT_EQ(myarray.front(), "a");
+  myarray.swap(myarray2);
+  ASSERT_EQ(myarray.front(), "z");
+  ASSERT_EQ(myarray2.front(), "a");
+  const mycontainers::array<std::string, 3> &constArray = myarray;
+  ASSERT_EQ(constArray.at(1), "b");
+  ASSERT_EQ(constArray.end() - constArray.begin(), 3);
+}
+
+TEST(array, zero_size) {
+  mycontainers::array<std::string, 0> myarray{};
+  ASSERT_TRUE(myarray.empty());
+  ASSERT_EQ(myarray.data(), nullptr);
+  ASSERT_EQ(myarray.begin(), myarray.end());
+  ASSERT_THROW(myarray.at(0), std::out_of_range);
+  myarray.fill("a");
+  myarray.swap(myarray);
+}
+
+constexpr mycontainers::array<std::uint32_t, 256> MakeCrc32Table() {
+  mycontainers::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr mycontainers::array<std::uint32_t, 256> kCrc32Table =
+    MakeCrc32Table();
+
+constexpr std::uint32_t Crc32(const char *text) {
+  std::uint32_t crc = 0xFFFFFFFFu;
+  for (; *text; ++text) {
+    crc = kCrc32Table[(crc ^ std::uint8_t(*text)) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+TEST(array, constexpr_table) {
+  static_assert(kCrc32Table[1] == 0x77073096u);
+  static_assert(kCrc32Table.back() == 0x2D02EF8Du);
+  static_assert(Crc32("123456789") == 0xCBF43926u);
+
+  constexpr mycontainers::array<int, 3> first{1, 2, 3};
+  constexpr mycontainers::array<int, 3> second{1, 2, 4};
+  static_assert(first == first && first != second);
+  static_assert(first < second && second > first);
+  static_assert(first <= first && second >= first);
+  static_assert(!(second < first) && !(first < first));
+  static_assert(first.size() == 3 && !first.empty());
+  static_assert(*first.begin() == 1 && first.end() - first.begin() == 3);
+  static_assert(first.front() + first.at(1) + first[2] == 6);
+
+  constexpr auto filled = [] {
+    mycontainers::array<int, 4> a{};
+    a.fill(7);
+    mycontainers::array<int, 4> b{1, 2, 3, 4};
+    a.swap(b);
+    return a;
+  }();
+  static_assert(filled == mycontainers::array<int, 4>{1, 2, 3, 4});
+  EXPECT_EQ(Crc32("The quick brown fox jumps over the lazy dog"),
+            0x414FA339u);
+}
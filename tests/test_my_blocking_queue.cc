@@ -0,0 +1,111 @@
+#include <atomic>
+#include <chrono>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../my_blocking_queue.h"
+#include "gtest/gtest.h"
+
+TEST(blocking_queue, push_pop) {
+  mycontainers::blocking_queue<std::string> myQueue;
+  std::queue<std::string> stdQueue;
+  EXPECT_EQ(myQueue.capacity(), 0u);
+  EXPECT_TRUE(myQueue.empty());
+  std::string out;
+  for (int i = 0; i < 50; ++i) {
+    std::string value(20, char('a' + i % 26));
+    ASSERT_TRUE(myQueue.push(value));
+    stdQueue.push(value);
+    if (i % 3 == 2) {
+      ASSERT_TRUE(myQueue.pop(out));
+      ASSERT_EQ(out, stdQueue.front());
+      stdQueue.pop();
+    }
+    ASSERT_EQ(stdQueue.size(), myQueue.size());
+  }
+}
+
+TEST(blocking_queue, batches) {
+  mycontainers::blocking_queue<int> myQueue;
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7};
+  std::vector<int> output(7);
+  EXPECT_EQ(myQueue.push_batch(input.begin(), 7), 7u);
+  EXPECT_EQ(myQueue.pop_batch(output.begin(), 3), 3u);
+  EXPECT_EQ(myQueue.pop_batch(output.begin() + 3, 10), 4u);
+  EXPECT_EQ(output, input);
+  EXPECT_EQ(myQueue.pop_batch(output.begin(), 0), 0u);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(myQueue.pop_batch(output.begin(), 3, std::chrono::milliseconds(20)),
+            0u);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+}
+
+TEST(blocking_queue, close) {
+  mycontainers::blocking_queue<int> myQueue(2);
+  EXPECT_EQ(myQueue.capacity(), 2u);
+  std::vector<int> input{1, 2, 3, 4, 5};
+  // Blocks on the full queue until close().
+  std::thread producer([&myQueue, &input] {
+    EXPECT_EQ(myQueue.push_batch(input.begin(), input.size()), 2u);
+  });
+  mycontainers::blocking_queue<int> idleQueue;
+  std::thread consumer([&idleQueue] {
+    int value = 0;
+    EXPECT_FALSE(idleQueue.pop(value));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  myQueue.close();
+  idleQueue.close();
+  producer.join();
+  consumer.join();
+  EXPECT_TRUE(myQueue.closed());
+  EXPECT_FALSE(myQueue.push(6));
+  int value = 0;
+  EXPECT_TRUE(myQueue.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(myQueue.pop_batch(&value, 5, std::chrono::seconds(10)), 1u);
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(myQueue.pop(value));
+}
+
+TEST(blocking_queue, threads) {
+  mycontainers::blocking_queue<int> myQueue(16);
+  const int kProducers = 3;
+  const int kConsumers = 3;
+  const int kPerProducer = 20000;
+  std::atomic<long> sum{0};
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < kConsumers; ++c) {
+    consumers.emplace_back([&myQueue, &sum, c] {
+      int batch[8];
+      long local = 0;
+      while (size_t n = myQueue.pop_batch(batch, size_t(c + 1))) {
+        for (size_t i = 0; i < n; ++i) local += batch[i];
+      }
+      sum += local;
+    });
+  }
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&myQueue, p] {
+      std::vector<int> batch;
+      for (int i = p; i < kProducers * kPerProducer; i += kProducers) {
+        batch.push_back(i);
+        if (batch.size() == size_t(p * 10 + 1)) {
+          ASSERT_EQ(myQueue.push_batch(batch.begin(), batch.size()),
+                    batch.size());
+          batch.clear();
+        }
+      }
+      myQueue.push_batch(batch.begin(), batch.size());
+    });
+  }
+  for (auto &thread : producers) thread.join();
+  myQueue.close();
+  for (auto &thread : consumers) thread.join();
+  long total = long(kProducers) * kPerProducer;
+  EXPECT_EQ(sum, total * (total - 1) / 2);
+}
@@ -0,0 +1,139 @@
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "../my_concurrent_map.h"
+#include "gtest/gtest.h"
+
+TEST(concurrent_map, constructor) {
+  mycontainers::concurrent_map<int, int> myMap;
+  std::map<int, int> stdMap;
+  ASSERT_EQ(myMap.size(), stdMap.size());
+  ASSERT_EQ(myMap.empty(), stdMap.empty());
+}
+
+TEST(concurrent_map, constructor_initializer) {
+  mycontainers::concurrent_map<int, int> myMap{{3, 30}, {1, 10}, {2, 20}};
+  std::map<int, int> stdMap{{3, 30}, {1, 10}, {2, 20}};
+  ASSERT_EQ(myMap.size(), stdMap.size());
+  ASSERT_EQ(myMap.empty(), stdMap.empty());
+  auto it = stdMap.begin();
+  myMap.for_each([&](const std::pair<const int, int> &value) {
+    ASSERT_EQ(it->first, value.first);
+    ASSERT_EQ(it->second, value.second);
+    ++it;
+  });
+  ASSERT_TRUE(it == stdMap.end());
+}
+
+TEST(concurrent_map, insert) {
+  mycontainers::concurrent_map<std::string, int> myMap;
+  std::map<std::string, int> stdMap;
+  ASSERT_EQ(myMap.insert("b", 2), stdMap.insert({"b", 2}).second);
+  ASSERT_EQ(myMap.insert("a", 1), stdMap.insert({"a", 1}).second);
+  ASSERT_EQ(myMap.insert("b", 3), stdMap.insert({"b", 3}).second);
+  ASSERT_EQ(myMap.size(), stdMap.size());
+  ASSERT_EQ(*myMap.find("b"), stdMap.find("b")->second);
+}
+
+TEST(concurrent_map, find) {
+  mycontainers::concurrent_map<int, int> myMap{{1, 10}, {5, 50}};
+  ASSERT_EQ(*myMap.find(5), 50);
+  ASSERT_FALSE(myMap.find(4).has_value());
+  ASSERT_TRUE(myMap.contains(1));
+  ASSERT_FALSE(myMap.contains(2));
+}
+
+TEST(concurrent_map, erase) {
+  mycontainers::concurrent_map<int, int> myMap;
+  std::map<int, int> stdMap;
+  for (int i = 0; i < 1000; ++i) {
+    myMap.insert(i, -i);
+    stdMap.insert({i, -i});
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    ASSERT_EQ(myMap.erase(i), stdMap.erase(i) > 0);
+  }
+  ASSERT_FALSE(myMap.erase(3));
+  ASSERT_EQ(myMap.size(), stdMap.size());
+  auto it = stdMap.begin();
+  myMap.for_each([&](const std::pair<const int, int> &value) {
+    ASSERT_EQ(it->first, value.first);
+    ++it;
+  });
+  ASSERT_TRUE(it == stdMap.end());
+}
+
+TEST(concurrent_map, lower_bound) {
+  mycontainers::concurrent_map<int, int> myMap{{10, 1}, {20, 2}, {30, 3}};
+  std::map<int, int> stdMap{{10, 1}, {20, 2}, {30, 3}};
+  for (int key : {5, 10, 15, 30}) {
+    ASSERT_EQ(myMap.lower_bound(key)->first, stdMap.lower_bound(key)->first);
+  }
+  ASSERT_FALSE(myMap.lower_bound(31).has_value());
+}
+
+TEST(concurrent_map, for_each_range) {
+  mycontainers::concurrent_map<int, int> myMap;
+  for (int i = 0; i < 100; ++i) myMap.insert(i, i);
+  int sum = 0;
+  int count = 0;
+  myMap.for_each(10, 20, [&](const std::pair<const int, int> &value) {
+    sum += value.second;
+    ++count;
+  });
+  ASSERT_EQ(count, 10);
+  ASSERT_EQ(sum, 145);
+}
+
+TEST(concurrent_map, clear) {
+  mycontainers::concurrent_map<int, int> myMap{{1, 1}, {2, 2}, {3, 3}};
+  myMap.clear();
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_FALSE(myMap.contains(2));
+  ASSERT_TRUE(myMap.insert(2, 2));
+}
+
+TEST(concurrent_map, threads_insert_erase) {
+  mycontainers::concurrent_map<int, int> myMap;
+  const int kThreads = 4;
+  const int kPerThread = 2000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&myMap, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        int key = i * kThreads + t;
+        myMap.insert(key, key);
+        if (i % 2) myMap.erase(key);
+        myMap.contains(key - 1);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  ASSERT_EQ(myMap.size(), size_t(kThreads * kPerThread / 2));
+  int previous = -1;
+  myMap.for_each([&](const std::pair<const int, int> &value) {
+    ASSERT_LT(previous, value.first);
+    ASSERT_EQ((value.first / kThreads) % 2, 0);
+    previous = value.first;
+  });
+}
+
+TEST(concurrent_map, threads_same_keys) {
+  mycontainers::concurrent_map<int, int> myMap;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&myMap, t] {
+      for (int i = 0; i < 500; ++i) {
+        myMap.insert(i, t);
+        myMap.erase(i / 2);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  size_t count = 0;
+  myMap.for_each([&](const std::pair<const int, int> &) { ++count; });
+  ASSERT_EQ(count, myMap.size());
+}
@@ -0,0 +1,129 @@
+#include <random>
+#include <set>
+#include <string>
+
+#include "../my_counted_multiset.h"
+#include "gtest/gtest.h"
+
+static void ExpectSameMultiset(
+    const std::multiset<int> &stdMultiset,
+    const mycontainers::MyCountedMultiset<int> &myMultiset) {
+  EXPECT_EQ(stdMultiset.size(), myMultiset.size());
+  mycontainers::MyCountedMultiset<int>::iterator myIt = myMultiset.begin();
+  for (int key : stdMultiset) {
+    EXPECT_EQ(key, *myIt);
+    ++myIt;
+  }
+  EXPECT_TRUE(myIt == myMultiset.end());
+}
+
+TEST(CountedMultisetTest, TestCountedMultisetConstructor) {
+  mycontainers::MyCountedMultiset<int> myMultiset;
+  std::multiset<int> stdMultiset;
+  EXPECT_EQ(stdMultiset.size(), myMultiset.size());
+  EXPECT_EQ(stdMultiset.empty(), myMultiset.empty());
+  EXPECT_TRUE(myMultiset.begin() == myMultiset.end());
+
+  mycontainers::MyCountedMultiset<int> myItems{3, 1, 3, 2, 3, 1};
+  std::multiset<int> stdItems{3, 1, 3, 2, 3, 1};
+  ExpectSameMultiset(stdItems, myItems);
+  EXPECT_EQ(myItems.distinct_size(), 3U);
+
+  mycontainers::MyCountedMultiset<int> myCopy(myItems);
+  mycontainers::MyCountedMultiset<int> myMoved(std::move(myItems));
+  EXPECT_TRUE(myItems.empty());
+  ExpectSameMultiset(stdItems, myCopy);
+  ExpectSameMultiset(stdItems, myMoved);
+
+  myCopy = myMultiset;
+  EXPECT_TRUE(myCopy.empty());
+  myCopy = std::move(myMoved);
+  ExpectSameMultiset(stdItems, myCopy);
+}
+
+TEST(CountedMultisetTest, TestCountedMultisetInsertErase) {
+  mycontainers::MyCountedMultiset<int> myMultiset;
+  std::multiset<int> stdMultiset;
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> keys(0, 9);
+  for (int i = 0; i < 20000; ++i) {
+    int key = keys(gen);
+    if (gen() % 4 == 0) {
+      auto stdIt = stdMultiset.find(key);
+      if (stdIt != stdMultiset.end()) {
+        stdMultiset.erase(stdIt);
+        myMultiset.erase(myMultiset.find(key));
+      }
+    } else {
+      EXPECT_EQ(*stdMultiset.insert(key), *myMultiset.insert(key));
+    }
+  }
+  ExpectSameMultiset(stdMultiset, myMultiset);
+  EXPECT_LE(myMultiset.distinct_size(), 10U);
+
+  EXPECT_EQ(stdMultiset.erase(5), myMultiset.erase(5));
+  EXPECT_EQ(stdMultiset.erase(5), myMultiset.erase(5));
+  ExpectSameMultiset(stdMultiset, myMultiset);
+
+  myMultiset.clear();
+  EXPECT_TRUE(myMultiset.empty());
+  EXPECT_EQ(myMultiset.distinct_size(), 0U);
+}
+
+TEST(CountedMultisetTest, TestCountedMultisetLookup) {
+  std::multiset<int> stdMultiset{1, 1, 1, 4, 4, 9};
+  mycontainers::MyCountedMultiset<int> myMultiset{1, 1, 1, 4, 4, 9};
+  myMultiset.insert(7, 0);
+
+  for (int key = 0; key < 11; ++key) {
+    EXPECT_EQ(stdMultiset.count(key), myMultiset.count(key));
+    EXPECT_EQ(stdMultiset.count(key) > 0, myMultiset.contains(key));
+    auto stdRange = stdMultiset.equal_range(key);
+    auto myRange = myMultiset.equal_range(key);
+    size_t distance = 0;
+    for (; myRange.first != myRange.second; ++myRange.first) ++distance;
+    EXPECT_EQ(static_cast<size_t>(std::distance(stdRange.first,
+                                                stdRange.second)),
+              distance);
+    if (stdMultiset.lower_bound(key) != stdMultiset.end()) {
+      EXPECT_EQ(*stdMultiset.lower_bound(key), *myMultiset.lower_bound(key));
+    }
+    if (stdMultiset.upper_bound(key) != stdMultiset.end()) {
+      EXPECT_EQ(*stdMultiset.upper_bound(key), *myMultiset.upper_bound(key));
+    }
+  }
+  EXPECT_TRUE(myMultiset.find(2) == myMultiset.end());
+  EXPECT_EQ(*myMultiset.find(4), 4);
+}
+
+TEST(CountedMultisetTest, TestCountedMultisetIterator) {
+  std::multiset<std::string> stdMultiset{"b", "a", "b", "c", "b"};
+  mycontainers::MyCountedMultiset<std::string> myMultiset{"b", "a", "b", "c",
+                                                          "b"};
+  auto stdIt = stdMultiset.end();
+  auto myIt = myMultiset.end();
+  while (stdIt != stdMultiset.begin()) {
+    --stdIt;
+    --myIt;
+    EXPECT_EQ(*stdIt, *myIt);
+  }
+  EXPECT_TRUE(myIt == myMultiset.begin());
+}
+
+TEST(CountedMultisetTest, TestCountedMultisetMergeSwap) {
+  std::multiset<int> stdFirst{1, 2, 2}, stdSecond{2, 3, 3};
+  mycontainers::MyCountedMultiset<int> myFirst{1, 2, 2}, mySecond{2, 3, 3};
+  stdFirst.merge(stdSecond);
+  myFirst.merge(mySecond);
+  ExpectSameMultiset(stdFirst, myFirst);
+  EXPECT_TRUE(mySecond.empty());
+
+  mySecond.insert(8, 3);
+  myFirst.swap(mySecond);
+  ExpectSameMultiset(std::multiset<int>{8, 8, 8}, myFirst);
+  ExpectSameMultiset(stdFirst, mySecond);
+
+  auto result = myFirst.insert_many(8, 9);
+  EXPECT_EQ(result.size(), 2U);
+  EXPECT_EQ(myFirst.count(8), 4U);
+}
@@ -0,0 +1,148 @@
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../my_deque.h"
+#include "../my_queue.h"
+#include "../my_stack.h"
+#include "gtest/gtest.h"
+
+template <class T>
+static void ExpectSameElements(const std::deque<T> &stdDeque,
+                               const mycontainers::deque<T> &myDeque) {
+  ASSERT_EQ(stdDeque.size(), myDeque.size());
+  ASSERT_EQ(stdDeque.empty(), myDeque.empty());
+  auto myIt = myDeque.cbegin();
+  for (size_t i = 0; i < stdDeque.size(); ++i, ++myIt) {
+    ASSERT_EQ(stdDeque[i], myDeque[i]);
+    ASSERT_EQ(stdDeque[i], *myIt);
+  }
+  ASSERT_TRUE(myIt == myDeque.cend());
+  if (!stdDeque.empty()) {
+    ASSERT_EQ(stdDeque.front(), myDeque.front());
+    ASSERT_EQ(stdDeque.back(), myDeque.back());
+  }
+}
+
+TEST(deque, constructors) {
+  mycontainers::deque<std::string> myDeque{"a", "b", "c"};
+  std::deque<std::string> stdDeque{"a", "b", "c"};
+  ExpectSameElements(stdDeque, myDeque);
+
+  mycontainers::deque<std::string> myCopy(myDeque);
+  ExpectSameElements(stdDeque, myCopy);
+  mycontainers::deque<std::string> myMoved(std::move(myCopy));
+  ExpectSameElements(stdDeque, myMoved);
+  ASSERT_TRUE(myCopy.empty());
+  myCopy = myMoved;
+  myMoved = std::move(myDeque);
+  ExpectSameElements(stdDeque, myCopy);
+  ExpectSameElements(stdDeque, myMoved);
+  myCopy.push_front("z");
+  myMoved = myCopy;
+  stdDeque.push_front("z");
+  ExpectSameElements(stdDeque, myMoved);
+}
+
+TEST(deque, access_across_blocks) {
+  const int count = int(mycontainers::deque<int>::block_size()) * 5 + 3;
+  mycontainers::deque<int> myDeque;
+  std::deque<int> stdDeque;
+  for (int i = 0; i < count; ++i) {
+    myDeque.push_back(i);
+    myDeque.push_front(-i);
+    stdDeque.push_back(i);
+    stdDeque.push_front(-i);
+  }
+  ExpectSameElements(stdDeque, myDeque);
+  myDeque.at(7) = 70;
+  ASSERT_EQ(myDeque[7], 70);
+  ASSERT_THROW(myDeque.at(myDeque.size()), std::out_of_range);
+  myDeque.clear();
+  ASSERT_TRUE(myDeque.empty());
+  myDeque.shrink_to_fit();
+  myDeque.push_front(1);
+  ASSERT_EQ(myDeque.back(), 1);
+}
+
+TEST(deque, references_survive_end_insertions) {
+  const int count = int(mycontainers::deque<std::string>::block_size()) * 40;
+  mycontainers::deque<std::string> myDeque{"first"};
+  std::string *first = &myDeque.front();
+  std::vector<std::string *> pointers;
+  for (int i = 0; i < count; ++i) {
+    myDeque.push_back(std::to_string(i));
+    pointers.push_back(&myDeque.back());
+    myDeque.push_front(std::to_string(-i));
+  }
+  ASSERT_EQ(first, &myDeque[count]);
+  ASSERT_EQ(*first, "first");
+  for (int i = 0; i < count; ++i) {
+    ASSERT_EQ(pointers[i], &myDeque[count + 1 + i]);
+    ASSERT_EQ(*pointers[i], std::to_string(i));
+  }
+  for (int i = 0; i < count; ++i) myDeque.pop_front();
+  myDeque.shrink_to_fit();
+  ASSERT_EQ(first, &myDeque.front());
+}
+
+TEST(deque, random_operations) {
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> ops(0, 5);
+  mycontainers::deque<std::string> myDeque;
+  std::deque<std::string> stdDeque;
+  for (int i = 0; i < 20000; ++i) {
+    std::string value = std::to_string(i);
+    switch (ops(gen)) {
+      case 0:
+        myDeque.push_back(value);
+        stdDeque.push_back(value);
+        break;
+      case 1:
+        myDeque.push_front(value);
+        stdDeque.push_front(value);
+        break;
+      case 2:
+        myDeque.pop_front();
+        if (!stdDeque.empty()) stdDeque.pop_front();
+        break;
+      case 3:
+        myDeque.pop_back();
+        if (!stdDeque.empty()) stdDeque.pop_back();
+        break;
+      case 4:
+        if (!stdDeque.empty()) {
+          myDeque.push_back(myDeque.front());
+          stdDeque.push_back(stdDeque.front());
+        }
+        break;
+      default:
+        if (!stdDeque.empty()) {
+          myDeque.push_front(myDeque.back());
+          stdDeque.push_front(stdDeque.back());
+        }
+    }
+    ASSERT_EQ(myDeque.size(), stdDeque.size());
+    if (i % 1000 == 0) myDeque.shrink_to_fit();
+  }
+  ExpectSameElements(stdDeque, myDeque);
+}
+
+TEST(deque, queue_and_stack_backend) {
+  mycontainers::MyQueue<int, mycontainers::deque<int>> myQueue;
+  mycontainers::MyStack<int, mycontainers::deque<int>> myStack;
+  for (int i = 0; i < 1000; ++i) {
+    myQueue.push(i);
+    myStack.push(i);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(myQueue.pop_value(), i);
+    ASSERT_EQ(myStack.pop_value(), 999 - i);
+  }
+  ASSERT_TRUE(myQueue.empty());
+  ASSERT_TRUE(myStack.empty());
+  myStack.insert_many_front(1, 2, 3);
+  ASSERT_EQ(myStack.top(), 3);
+}
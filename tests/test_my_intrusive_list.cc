@@ -0,0 +1,263 @@
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../my_intrusive_list.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+struct Timer {
+  explicit Timer(int deadline) : deadline(deadline) {}
+
+  bool operator==(const Timer &other) const {
+    return deadline == other.deadline;
+  }
+  bool operator<(const Timer &other) const {
+    return deadline < other.deadline;
+  }
+
+  int deadline;
+  mycontainers::list_hook hook;
+  mycontainers::list_hook second;
+  mycontainers::auto_unlink_hook safe;
+};
+
+using TimerList = mycontainers::intrusive_list<Timer, &Timer::hook>;
+using SecondList = mycontainers::intrusive_list<Timer, &Timer::second>;
+using SafeList = mycontainers::intrusive_list<Timer, &Timer::safe>;
+
+template <class List>
+void ExpectDeadlines(const List &myList, const std::list<int> &deadlines) {
+  ASSERT_EQ(myList.size(), deadlines.size());
+  ASSERT_EQ(myList.empty(), deadlines.empty());
+  auto it = myList.begin();
+  for (int deadline : deadlines) {
+    ASSERT_EQ(it->deadline, deadline);
+    ++it;
+  }
+  ASSERT_TRUE(it == myList.end());
+}
+
+}  // namespace
+
+TEST(intrusive_list, links_objects_in_place) {
+  Timer first(1), second(2), third(3);
+  TimerList myList;
+  myList.push_back(second);
+  myList.push_front(first);
+  myList.push_back(third);
+  ExpectDeadlines(myList, {1, 2, 3});
+  ASSERT_EQ(&myList.front(), &first);
+  ASSERT_EQ(&myList.back(), &third);
+  ASSERT_TRUE(second.hook.is_linked());
+
+  first.deadline = 10;
+  ASSERT_EQ(myList.front().deadline, 10);
+
+  myList.pop_front();
+  myList.pop_back();
+  ExpectDeadlines(myList, {2});
+  ASSERT_FALSE(first.hook.is_linked());
+  ASSERT_FALSE(third.hook.is_linked());
+  myList.clear();
+  ASSERT_TRUE(myList.empty());
+  ASSERT_FALSE(second.hook.is_linked());
+  myList.pop_front();
+  myList.pop_back();
+  ASSERT_TRUE(myList.empty());
+}
+
+TEST(intrusive_list, insert_and_erase_anywhere) {
+  std::vector<std::unique_ptr<Timer>> pool;
+  for (int i = 0; i < 6; ++i) pool.push_back(std::make_unique<Timer>(i));
+  TimerList myList;
+  for (auto &timer : pool) myList.push_back(*timer);
+
+  auto next = myList.erase(myList.iterator_to(*pool[3]));
+  ASSERT_EQ(next->deadline, 4);
+  myList.erase(myList.iterator_to(*pool[0]));
+  myList.insert(myList.iterator_to(*pool[5]), *pool[0]);
+  ExpectDeadlines(myList, {1, 2, 4, 0, 5});
+  ASSERT_EQ(myList.insert(myList.cend(), *pool[3])->deadline, 3);
+  ExpectDeadlines(myList, {1, 2, 4, 0, 5, 3});
+}
+
+TEST(intrusive_list, object_in_two_lists) {
+  Timer first(1), second(2);
+  TimerList byHook;
+  SecondList bySecond;
+  byHook.push_back(first);
+  byHook.push_back(second);
+  bySecond.push_back(second);
+  bySecond.push_back(first);
+  ExpectDeadlines(byHook, {1, 2});
+  ExpectDeadlines(bySecond, {2, 1});
+  byHook.clear();
+  ExpectDeadlines(bySecond, {2, 1});
+  bySecond.clear();
+}
+
+TEST(intrusive_list, move_swap_splice) {
+  Timer a(1), b(2), c(3), d(4), e(5);
+  TimerList myList;
+  myList.push_back(a);
+  myList.push_back(b);
+  TimerList myMoved(std::move(myList));
+  ASSERT_TRUE(myList.empty());
+  ExpectDeadlines(myMoved, {1, 2});
+
+  TimerList myOther;
+  myOther.push_back(c);
+  myOther.swap(myMoved);
+  ExpectDeadlines(myOther, {1, 2});
+  ExpectDeadlines(myMoved, {3});
+
+  myMoved.push_back(d);
+  myMoved.push_back(e);
+  myOther.splice(++myOther.cbegin(), myMoved);
+  ExpectDeadlines(myOther, {1, 3, 4, 5, 2});
+  ASSERT_TRUE(myMoved.empty());
+
+  myList = std::move(myOther);
+  ExpectDeadlines(myList, {1, 3, 4, 5, 2});
+  ASSERT_TRUE(myOther.empty());
+}
+
+TEST(intrusive_list, splice_element_and_range) {
+  std::vector<std::unique_ptr<Timer>> pool;
+  for (int i = 0; i < 6; ++i) pool.push_back(std::make_unique<Timer>(i));
+  TimerList myList;
+  TimerList myOther;
+  for (int i = 0; i < 3; ++i) myList.push_back(*pool[i]);
+  for (int i = 3; i < 6; ++i) myOther.push_back(*pool[i]);
+
+  myList.splice(myList.cbegin(), myOther, myOther.iterator_to(*pool[4]));
+  ExpectDeadlines(myList, {4, 0, 1, 2});
+  ExpectDeadlines(myOther, {3, 5});
+  myList.splice(myList.cend(), myList, myList.cbegin());
+  ExpectDeadlines(myList, {0, 1, 2, 4});
+
+  myOther.splice(++myOther.cbegin(), myList, ++myList.cbegin(),
+                 myList.iterator_to(*pool[4]));
+  ExpectDeadlines(myList, {0, 4});
+  ExpectDeadlines(myOther, {3, 1, 2, 5});
+  myList.splice(myList.cend(), myOther, myOther.cbegin(), myOther.cend(), 4);
+  ExpectDeadlines(myList, {0, 4, 3, 1, 2, 5});
+  ASSERT_TRUE(myOther.empty());
+}
+
+TEST(intrusive_list, sort_merge_unique_reverse) {
+  std::list<int> deadlines{5, 3, 3, 9, 1, 1, 1, 7, 3};
+  std::list<int> otherDeadlines{8, 4, 4, 2};
+  std::vector<std::unique_ptr<Timer>> pool;
+  TimerList myList;
+  TimerList myOther;
+  for (int deadline : deadlines) {
+    pool.push_back(std::make_unique<Timer>(deadline));
+    myList.push_back(*pool.back());
+  }
+  for (int deadline : otherDeadlines) {
+    pool.push_back(std::make_unique<Timer>(deadline));
+    myOther.push_back(*pool.back());
+  }
+
+  deadlines.sort();
+  myList.sort();
+  ExpectDeadlines(myList, deadlines);
+  otherDeadlines.sort(std::greater<int>());
+  myOther.sort([](const Timer &a, const Timer &b) { return b < a; });
+  ExpectDeadlines(myOther, otherDeadlines);
+  otherDeadlines.reverse();
+  myOther.reverse();
+  ExpectDeadlines(myOther, otherDeadlines);
+
+  deadlines.merge(otherDeadlines);
+  myList.merge(myOther);
+  ExpectDeadlines(myList, deadlines);
+  ASSERT_TRUE(myOther.empty());
+  deadlines.unique();
+  myList.unique();
+  ExpectDeadlines(myList, deadlines);
+  size_t linked = 0;
+  for (auto &timer : pool) linked += timer->hook.is_linked();
+  ASSERT_EQ(linked, myList.size());
+}
+
+TEST(intrusive_list, sort_is_stable_and_parallel) {
+  std::mt19937 gen(3);
+  std::vector<Timer> pool;
+  pool.reserve(100000);
+  std::list<int> deadlines;
+  TimerList myList;
+  for (int i = 0; i < 100000; ++i) {
+    pool.emplace_back(gen() % 1000);
+    deadlines.push_back(pool.back().deadline);
+  }
+  for (Timer &timer : pool) myList.push_back(timer);
+  myList.sort(std::less<Timer>(), true);
+  deadlines.sort();
+  ExpectDeadlines(myList, deadlines);
+  const Timer *previous = nullptr;
+  for (const Timer &timer : myList) {
+    if (previous && previous->deadline == timer.deadline) {
+      ASSERT_LT(previous, &timer);
+    }
+    previous = &timer;
+  }
+}
+
+TEST(intrusive_list, throwing_comparator_keeps_lists) {
+  std::vector<Timer> pool;
+  for (int deadline : {5, 3, 9, 1, 7, 2, 8}) pool.emplace_back(deadline);
+  TimerList myList;
+  TimerList myOther;
+  for (size_t i = 0; i < pool.size(); ++i) {
+    (i % 2 ? myOther : myList).push_back(pool[i]);
+  }
+  int calls = 3;
+  auto less = [&calls](const Timer &a, const Timer &b) {
+    if (--calls < 0) throw std::runtime_error("compare");
+    return a < b;
+  };
+  ASSERT_THROW(myList.sort(less), std::runtime_error);
+  ExpectDeadlines(myList, {5, 9, 7, 8});
+  myList.sort();
+  myOther.sort();
+  calls = 2;
+  ASSERT_THROW(myList.merge(myOther, less), std::runtime_error);
+  ExpectDeadlines(myList, {5, 7, 8, 9});
+  ExpectDeadlines(myOther, {1, 2, 3});
+}
+
+TEST(intrusive_list, auto_unlink_hook) {
+  SafeList myList;
+  Timer first(1);
+  {
+    Timer second(2);
+    myList.push_back(first);
+    myList.push_back(second);
+    Timer third(3);
+    myList.push_back(third);
+    ExpectDeadlines(myList, {1, 2, 3});
+  }
+  ExpectDeadlines(myList, {1});
+
+  Timer fourth(4);
+  myList.push_front(fourth);
+  Timer copy(fourth);
+  ASSERT_FALSE(copy.safe.is_linked());
+  fourth.safe.unlink();
+  ASSERT_FALSE(fourth.safe.is_linked());
+  ExpectDeadlines(myList, {1});
+  fourth.safe.unlink();
+
+  {
+    SafeList shortLived;
+    shortLived.push_back(fourth);
+  }
+  ASSERT_FALSE(fourth.safe.is_linked());
+}
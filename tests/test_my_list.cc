@@ -1,4 +1,11 @@
+#include <atomic>
+#include <functional>
 #include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "../my_list.h"
 #include "gtest/gtest.h"
@@ -443,6 +450,281 @@ TEST(list, sort) {
   }
 }
 
+// Has no default constructor and counts how many objects were created.
+class Tracked {
+ public:
+  explicit Tracked(int value) : value_(value) { ++created; }
+  Tracked(const Tracked &other) : value_(other.value_) { ++created; }
+  Tracked &operator=(const Tracked &other) = default;
+
+  bool operator==(const Tracked &other) const {
+    return value_ == other.value_;
+  }
+  bool operator<(const Tracked &other) const { return value_ < other.value_; }
+
+  static int created;
+
+ private:
+  int value_;
+};
+
+int Tracked::created = 0;
+
+TEST(list, empty_list_creates_no_elements) {
+  Tracked::created = 0;
+  mycontainers::list<Tracked> myList;
+  mycontainers::list<Tracked> myMoved(std::move(myList));
+  myList = std::move(myMoved);
+  myList.swap(myMoved);
+  ASSERT_EQ(Tracked::created, 0);
+  ASSERT_EQ(myList.capacity(), 0u);
+  ASSERT_TRUE(myMoved.begin() == myMoved.end());
+}
+
+TEST(list, element_without_default_constructor) {
+  mycontainers::list<Tracked> myList;
+  myList.push_back(Tracked(3));
+  myList.push_front(Tracked(1));
+  myList.insert(++myList.begin(), Tracked(2));
+  myList.insert_many_back(Tracked(2));
+  mycontainers::list<Tracked> myOther{Tracked(0), Tracked(5)};
+  myList.sort();
+  myList.merge(myOther);
+  myList.unique();
+  myList.reverse();
+  ASSERT_EQ(myList.size(), 5u);
+  ASSERT_TRUE(myList.front() == Tracked(5));
+  ASSERT_TRUE(myList.back() == Tracked(0));
+
+  mycontainers::list<Tracked> myCopy(myList);
+  myList.clear();
+  myList.swap(myCopy);
+  ASSERT_TRUE(myCopy.empty());
+  ASSERT_EQ(myList.size(), 5u);
+}
+
+template <class T>
+static void ExpectSameElements(const std::list<T> &stdList,
+                               const mycontainers::list<T> &myList) {
+  ASSERT_EQ(stdList.size(), myList.size());
+  auto myIt = myList.begin();
+  for (const T &value : stdList) {
+    ASSERT_EQ(value, *myIt);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myList.end());
+  if (!stdList.empty()) {
+    ASSERT_EQ(stdList.back(), myList.back());
+  }
+}
+
+TEST(list, splice_element) {
+  std::list<int> stdList{1, 2, 3, 4};
+  std::list<int> stdOther{10, 20, 30};
+  mycontainers::list<int> myList{1, 2, 3, 4};
+  mycontainers::list<int> myOther{10, 20, 30};
+  myList.splice(++myList.cbegin(), myOther, ++myOther.cbegin());
+  stdList.splice(++stdList.cbegin(), stdOther, ++stdOther.cbegin());
+  ExpectSameElements(stdList, myList);
+  ExpectSameElements(stdOther, myOther);
+
+  myList.splice(myList.cend(), myList, myList.cbegin());
+  stdList.splice(stdList.cend(), stdList, stdList.cbegin());
+  ExpectSameElements(stdList, myList);
+  myList.splice(myList.cbegin(), myList, myList.cbegin());
+  myList.splice(++myList.cbegin(), myList, myList.cbegin());
+  ExpectSameElements(stdList, myList);
+
+  myList.splice(myList.cend(), myOther, myOther.cbegin());
+  myList.splice(myList.cend(), myOther, myOther.cbegin());
+  stdList.splice(stdList.cend(), stdOther, stdOther.cbegin());
+  stdList.splice(stdList.cend(), stdOther, stdOther.cbegin());
+  ExpectSameElements(stdList, myList);
+  ASSERT_TRUE(myOther.empty());
+}
+
+TEST(list, splice_range) {
+  std::list<int> stdList{1, 2, 3, 4, 5, 6};
+  std::list<int> stdOther{10, 20, 30, 40};
+  mycontainers::list<int> myList{1, 2, 3, 4, 5, 6};
+  mycontainers::list<int> myOther{10, 20, 30, 40};
+  auto myFirst = ++myOther.cbegin();
+  auto myLast = --myOther.cend();
+  auto stdFirst = ++stdOther.cbegin();
+  auto stdLast = --stdOther.cend();
+  myList.splice(++myList.cbegin(), myOther, myFirst, myLast);
+  stdList.splice(++stdList.cbegin(), stdOther, stdFirst, stdLast);
+  ExpectSameElements(stdList, myList);
+  ExpectSameElements(stdOther, myOther);
+
+  myList.splice(myList.cend(), myOther, myOther.cbegin(), myOther.cend(),
+                myOther.size());
+  stdList.splice(stdList.cend(), stdOther);
+  ExpectSameElements(stdList, myList);
+  ASSERT_TRUE(myOther.empty());
+
+  auto myMiddle = myList.cbegin();
+  auto stdMiddle = stdList.cbegin();
+  for (int i = 0; i < 3; ++i, ++myMiddle, ++stdMiddle) {
+  }
+  myList.splice(myList.cbegin(), myList, myMiddle, myList.cend());
+  stdList.splice(stdList.cbegin(), stdList, stdMiddle, stdList.cend());
+  ExpectSameElements(stdList, myList);
+  myList.splice(myList.cend(), myOther, myOther.cbegin(), myOther.cend());
+  ExpectSameElements(stdList, myList);
+}
+
+TEST(list, sort_elements) {
+  std::mt19937 gen(7);
+  for (size_t size : {0, 1, 2, 3, 17, 1000}) {
+    std::list<int> stdList;
+    mycontainers::list<int> myList;
+    for (size_t i = 0; i < size; ++i) {
+      int value = gen() % 100;
+      stdList.push_back(value);
+      myList.push_back(value);
+    }
+    stdList.sort();
+    myList.sort();
+    ExpectSameElements(stdList, myList);
+    stdList.sort(std::greater<int>());
+    myList.sort(std::greater<int>());
+    ExpectSameElements(stdList, myList);
+  }
+}
+
+TEST(list, sort_is_stable) {
+  // Elements compare by key / 100, so the lower digits keep the original
+  // order. The keys form ascending and strictly descending runs with equal
+  // neighbours.
+  int keys[] = {5, 5, 6, 9, 9, 8, 7, 7, 3, 2, 1, 4, 4, 0, 6, 5};
+  std::list<int> stdList;
+  mycontainers::list<int> myList;
+  for (int i = 0; i < 16; ++i) {
+    stdList.push_back(keys[i] * 100 + i);
+    myList.push_back(keys[i] * 100 + i);
+  }
+  auto byKey = [](int a, int b) { return a / 100 < b / 100; };
+  stdList.sort(byKey);
+  myList.sort(byKey);
+  ExpectSameElements(stdList, myList);
+}
+
+TEST(list, sort_presorted_runs) {
+  mycontainers::list<int> ascending;
+  mycontainers::list<int> descending;
+  for (int i = 0; i < 1000; ++i) {
+    ascending.push_back(i);
+    descending.push_front(i);
+  }
+  size_t comparisons = 0;
+  auto counting = [&comparisons](int a, int b) {
+    ++comparisons;
+    return a < b;
+  };
+  ascending.sort(counting);
+  ASSERT_EQ(comparisons, 999u);
+  comparisons = 0;
+  descending.sort(counting);
+  ASSERT_EQ(comparisons, 999u);
+  mycontainers::list<int>::ListIterator it = descending.begin();
+  for (int value : ascending) {
+    ASSERT_EQ(value, *it);
+    ++it;
+  }
+}
+
+TEST(list, sort_parallel) {
+  std::mt19937 gen(11);
+  std::list<unsigned> stdList;
+  mycontainers::list<unsigned> myList;
+  for (int i = 0; i < 200000; ++i) {
+    unsigned value = gen();
+    stdList.push_back(value);
+    myList.push_back(value);
+  }
+  stdList.sort();
+  myList.sort(std::less<unsigned>(), true);
+  ExpectSameElements(stdList, myList);
+  myList.push_back(0);
+  myList.pop_front();
+  ASSERT_EQ(myList.size(), stdList.size());
+}
+
+// Throws from the comparison once the budget of allowed calls runs out.
+struct ThrowingLess {
+  bool operator()(int a, int b) {
+    if (--*budget < 0) throw std::runtime_error("compare");
+    return a < b;
+  }
+
+  std::shared_ptr<std::atomic<long>> budget;
+};
+
+TEST(list, sort_throwing_comparator) {
+  for (long calls : {0L, 3L, 12L}) {
+    std::vector<int> items{5, 3, 9, 1, 7, 2, 8, 2, 6, 4, 0};
+    mycontainers::list<int> myList(items.begin(), items.end());
+    ThrowingLess less{std::make_shared<std::atomic<long>>(calls)};
+    ASSERT_THROW(myList.sort(less), std::runtime_error);
+    ExpectSameElements(std::list<int>(items.begin(), items.end()), myList);
+  }
+
+  std::mt19937 gen(13);
+  std::list<unsigned> stdList;
+  mycontainers::list<unsigned> myList;
+  for (int i = 0; i < 200000; ++i) {
+    unsigned value = gen();
+    stdList.push_back(value);
+    myList.push_back(value);
+  }
+  ThrowingLess less{std::make_shared<std::atomic<long>>(100000)};
+  auto parallelLess = [less](unsigned a, unsigned b) mutable {
+    return less(int(a >> 1), int(b >> 1));
+  };
+  ASSERT_THROW(myList.sort(parallelLess, true), std::runtime_error);
+  ExpectSameElements(stdList, myList);
+}
+
+// Compares like int, but throws once the shared budget of comparisons is
+// spent.
+struct ThrowingInt {
+  static int budget;
+
+  bool operator<(const ThrowingInt &other) const {
+    if (--budget < 0) throw std::runtime_error("compare");
+    return value < other.value;
+  }
+  bool operator==(const ThrowingInt &other) const {
+    return value == other.value;
+  }
+
+  int value;
+};
+
+int ThrowingInt::budget = 0;
+
+TEST(list, merge_throwing_comparison) {
+  mycontainers::list<ThrowingInt> myList{{1}, {4}, {6}, {9}};
+  mycontainers::list<ThrowingInt> myOther{{2}, {3}, {7}};
+  ThrowingInt::budget = 3;
+  ASSERT_THROW(myList.merge(myOther), std::runtime_error);
+  ASSERT_EQ(myList.size(), 4U);
+  ASSERT_EQ(myOther.size(), 3U);
+  ASSERT_TRUE(myList.back() == ThrowingInt{9});
+  ASSERT_TRUE(myOther.front() == ThrowingInt{2});
+  ThrowingInt::budget = 100;
+  myList.merge(myOther);
+  int expected[] = {1, 2, 3, 4, 6, 7, 9};
+  auto it = myList.begin();
+  for (int value : expected) {
+    ASSERT_EQ((*it).value, value);
+    ++it;
+  }
+  ASSERT_TRUE(it == myList.end());
+  ASSERT_TRUE(myOther.empty());
+}
+
 TEST(list, insert_many) {
   mycontainers::list<int> myList{1, 2, 3, 4};
   std::list<int_least16_t> stdList{1, 5, 6, 2, 3, 4};
@@ -489,3 +771,227 @@ TEST(list, insert_many_front) {
     ++myit;
   }
 }
+
+TEST(list, reserve) {
+  mycontainers::list<std::string> myList;
+  myList.reserve(10);
+  ASSERT_EQ(myList.capacity(), 10U);
+  ASSERT_TRUE(myList.empty());
+  for (int i = 0; i < 10; ++i) myList.push_back(std::to_string(i));
+  ASSERT_EQ(myList.capacity(), 10U);
+  myList.push_front("x");
+  ASSERT_EQ(myList.capacity(), 11U);
+  myList.reserve(5);
+  ASSERT_EQ(myList.capacity(), 11U);
+}
+
+TEST(list, recycle_nodes) {
+  mycontainers::list<std::string> myList{"a", "b", "c"};
+  std::list<std::string> stdList{"a", "b", "c"};
+  myList.pop_back();
+  myList.pop_front();
+  myList.erase(myList.begin());
+  ASSERT_EQ(myList.capacity(), 3U);
+  for (int i = 0; i < 1000; ++i) {
+    myList.push_back("queued message");
+    myList.pop_front();
+  }
+  ASSERT_EQ(myList.capacity(), 3U);
+  myList.push_back("a");
+  myList.insert(myList.begin(), "b");
+  myList.push_front("c");
+  stdList.clear();
+  stdList.push_back("a");
+  stdList.insert(stdList.begin(), "b");
+  stdList.push_front("c");
+  ASSERT_EQ(myList.capacity(), 3U);
+  auto it = stdList.begin();
+  for (auto myit = myList.begin(); myit != myList.end(); ++myit, ++it) {
+    ASSERT_EQ(*it, *myit);
+  }
+}
+
+TEST(list, clear_keeps_capacity) {
+  mycontainers::list<int> myList{1, 2, 3, 4, 5, 6};
+  myList.clear();
+  ASSERT_TRUE(myList.empty());
+  ASSERT_EQ(myList.capacity(), 6U);
+  myList.shrink_to_fit();
+  ASSERT_EQ(myList.capacity(), 0U);
+  myList.push_back(7);
+  ASSERT_EQ(myList.front(), 7);
+}
+
+TEST(list, recycle_spliced_nodes) {
+  mycontainers::list<int> myList{1, 2, 3};
+  {
+    mycontainers::list<int> other{4, 5, 6};
+    other.reserve(10);
+    myList.splice(myList.cbegin(), other);
+  }
+  ASSERT_EQ(myList.size(), 6U);
+  myList.clear();
+  ASSERT_EQ(myList.capacity(), 6U);
+}
+
+TEST(list, reserve_allocates_one_chunk) {
+  std::vector<std::string> items{"a", "b", "c", "d", "e"};
+  mycontainers::list<std::string> myList(items.data(),
+                                         items.data() + items.size());
+  const char *previous = nullptr;
+  for (const std::string &item : myList) {
+    const char *address = reinterpret_cast<const char *>(&item);
+    if (previous) {
+      ASSERT_EQ(address - previous,
+                std::ptrdiff_t(sizeof(mycontainers::list<std::string>::Node)));
+    }
+    previous = address;
+  }
+}
+
+// Any range that can be counted is reserved as one chunk, not only a
+// range of pointers.
+TEST(list, forward_ranges_reserve_one_chunk) {
+  auto expectContiguous = [](const mycontainers::list<std::string> &myList) {
+    const char *previous = nullptr;
+    for (const std::string &item : myList) {
+      const char *address = reinterpret_cast<const char *>(&item);
+      if (previous) {
+        ASSERT_EQ(address - previous,
+                  std::ptrdiff_t(
+                      sizeof(mycontainers::list<std::string>::Node)));
+      }
+      previous = address;
+    }
+  };
+  std::list<std::string> items{"a", "b", "c", "d", "e"};
+  mycontainers::list<std::string> myList(items.begin(), items.end());
+  ASSERT_EQ(myList.capacity(), 5U);
+  expectContiguous(myList);
+
+  mycontainers::list<std::string> myOther;
+  myOther.assign(items.begin(), items.end());
+  ASSERT_EQ(myOther.capacity(), 5U);
+  expectContiguous(myOther);
+}
+
+TEST(list, chunk_nodes_outlive_their_list) {
+  mycontainers::list<std::string> myList;
+  {
+    mycontainers::list<std::string> other{"a", "b", "c", "d"};
+    other.reserve(8);
+    myList.splice(myList.cend(), other, ++other.cbegin());
+    myList.splice(myList.cend(), other, other.cbegin(), other.cend());
+    other.push_back("e");
+    other.push_back("f");
+    myList.splice(myList.cbegin(), other, other.cbegin());
+  }
+  ExpectSameElements(std::list<std::string>{"e", "b", "a", "c", "d"}, myList);
+  myList.pop_front();
+  myList.shrink_to_fit();
+  myList.push_back("g");
+  mycontainers::list<std::string> myOther;
+  myOther.swap(myList);
+  myOther.merge(myList);
+  ExpectSameElements(std::list<std::string>{"b", "a", "c", "d", "g"},
+                     myOther);
+}
+
+TEST(list, remove_if_elements) {
+  mycontainers::list<int> myList{5, 1, 8, 2, 9, 9, 3, 7};
+  std::list<int> stdList{5, 1, 8, 2, 9, 9, 3, 7};
+  auto odd = [](int value) { return value % 2 != 0; };
+  ASSERT_EQ(myList.remove_if(odd), 6U);
+  stdList.remove_if(odd);
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.capacity(), 8U);
+
+  myList.insert_many_back(4, 2, 6);
+  stdList.insert(stdList.end(), {4, 2, 6});
+  ASSERT_EQ(mycontainers::erase_if(myList, [](int v) { return v > 5; }), 2U);
+  stdList.remove_if([](int v) { return v > 5; });
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.remove(2), 2U);
+  stdList.remove(2);
+  ExpectSameElements(stdList, myList);
+}
+
+TEST(list, remove_aliased_value) {
+  mycontainers::list<std::string> myList{"b", "a", "b", "c", "b"};
+  std::list<std::string> stdList{"a", "c"};
+  ASSERT_EQ(myList.remove(myList.front()), 3U);
+  ExpectSameElements(stdList, myList);
+}
+
+TEST(list, remove_if_throwing_predicate) {
+  mycontainers::list<int> myList{1, 2, 3, 4, 5};
+  std::list<int> stdList{3, 4, 5};
+  auto pred = [](int value) {
+    if (value == 3) throw std::runtime_error("stop");
+    return true;
+  };
+  ASSERT_THROW(myList.remove_if(pred), std::runtime_error);
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.capacity(), 5U);
+}
+
+TEST(list, unique_predicate) {
+  mycontainers::list<int> myList{1, 2, 4, 3, 10, 11, 12, 20, 5};
+  std::list<int> stdList{1, 2, 4, 3, 10, 11, 12, 20, 5};
+  auto close = [](int first, int value) { return value - first < 3; };
+  ASSERT_EQ(myList.unique(close), 5U);
+  stdList.unique(close);
+  ExpectSameElements(stdList, myList);
+}
+
+TEST(list, range_constructor) {
+  std::vector<std::string> items{"a", "b", "c", "d"};
+  mycontainers::list<std::string> myList(items.begin(), items.end());
+  std::list<std::string> stdList(items.begin(), items.end());
+  ExpectSameElements(stdList, myList);
+
+  mycontainers::list<std::string> myOther(++myList.cbegin(), myList.cend());
+  stdList.pop_front();
+  ExpectSameElements(stdList, myOther);
+  ASSERT_EQ(myOther.capacity(), 3U);
+
+  const int values[] = {3, 1, 2};
+  mycontainers::list<int> myInts(values, values + 3);
+  ExpectSameElements(std::list<int>{3, 1, 2}, myInts);
+}
+
+TEST(list, assign_reuses_nodes) {
+  mycontainers::list<int> myList{1, 2, 3, 4, 5};
+  std::list<int> stdList;
+  myList.assign({7, 8});
+  stdList.assign({7, 8});
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.capacity(), 5U);
+
+  myList.assign(4, 9);
+  stdList.assign(4, 9);
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.capacity(), 5U);
+
+  std::vector<int> items{1, 2, 3, 4, 5, 6, 7};
+  myList.assign(items.begin(), items.end());
+  stdList.assign(items.begin(), items.end());
+  ExpectSameElements(stdList, myList);
+  ASSERT_EQ(myList.capacity(), 7U);
+
+  mycontainers::list<int> myCopy{0};
+  myCopy = myList;
+  ExpectSameElements(stdList, myCopy);
+  ASSERT_EQ(myCopy.capacity(), 7U);
+}
+
+TEST(list, copy_without_default_constructor) {
+  mycontainers::list<Tracked> myList{Tracked(1), Tracked(2), Tracked(3)};
+  Tracked::created = 0;
+  mycontainers::list<Tracked> myCopy(myList);
+  ASSERT_EQ(Tracked::created, 3);
+  myCopy.assign(2, Tracked(5));
+  ASSERT_EQ(myCopy.size(), 2U);
+  ASSERT_TRUE(myCopy.back() == Tracked(5));
+  ASSERT_EQ(myCopy.capacity(), 3U);
+}
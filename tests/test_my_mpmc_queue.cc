@@ -0,0 +1,91 @@
+#include <atomic>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../my_mpmc_queue.h"
+#include "gtest/gtest.h"
+
+using IntQueue = mycontainers::mpmc_queue<int>;
+
+TEST(mpmc_queue, constructor) {
+  IntQueue myQueue(100);
+  EXPECT_EQ(myQueue.capacity(), 128u);
+  EXPECT_TRUE(myQueue.empty());
+  EXPECT_EQ(myQueue.mode(), IntQueue::wait_mode::spin);
+  EXPECT_EQ(IntQueue(0).capacity(), 2u);
+  EXPECT_THROW(IntQueue(size_t(-1)), std::length_error);
+}
+
+TEST(mpmc_queue, try_push_try_pop) {
+  mycontainers::mpmc_queue<std::string> myQueue(4);
+  std::queue<std::string> stdQueue;
+  std::string out;
+  for (int i = 0; i < 50; ++i) {
+    std::string value(20, char('a' + i % 26));
+    bool pushed = myQueue.try_push(value);
+    ASSERT_EQ(pushed, stdQueue.size() < 4);
+    if (pushed) stdQueue.push(value);
+    if (i % 3 == 2) {
+      ASSERT_TRUE(myQueue.try_pop(out));
+      ASSERT_EQ(out, stdQueue.front());
+      stdQueue.pop();
+    }
+    ASSERT_EQ(stdQueue.size(), myQueue.size());
+  }
+  while (myQueue.try_pop(out)) {
+    ASSERT_EQ(out, stdQueue.front());
+    stdQueue.pop();
+  }
+  EXPECT_TRUE(stdQueue.empty());
+  EXPECT_TRUE(myQueue.try_push(std::string("left for the destructor")));
+}
+
+// Every producer pushes its own increasing sequence; each consumer must
+// see every sequence in order, and all values must arrive exactly once.
+static void CheckThreads(IntQueue::wait_mode mode, int producers,
+                         int consumers) {
+  IntQueue myQueue(8, mode);
+  const int kPerProducer = 20000;
+  std::atomic<long> sum{0};
+  std::atomic<int> disorder{0};
+  std::vector<std::thread> threads;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      std::vector<int> last(producers, -1);
+      long local = 0;
+      for (int value;;) {
+        myQueue.pop(value);
+        if (value < 0) break;
+        int producer = value % producers;
+        if (value / producers <= last[producer]) ++disorder;
+        last[producer] = value / producers;
+        local += value;
+      }
+      sum += local;
+    });
+  }
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&myQueue, p, producers] {
+      for (int i = 0; i < kPerProducer; ++i) myQueue.push(i * producers + p);
+    });
+  }
+  for (int p = 0; p < producers; ++p) threads[consumers + p].join();
+  for (int c = 0; c < consumers; ++c) myQueue.push(-1);
+  for (int c = 0; c < consumers; ++c) threads[c].join();
+
+  long total = long(kPerProducer) * producers;
+  EXPECT_EQ(sum, total * (total - 1) / 2);
+  EXPECT_EQ(disorder, 0);
+  EXPECT_TRUE(myQueue.empty());
+}
+
+TEST(mpmc_queue, threads_spin) {
+  CheckThreads(IntQueue::wait_mode::spin, 3, 2);
+}
+
+TEST(mpmc_queue, threads_futex) {
+  CheckThreads(IntQueue::wait_mode::futex, 2, 3);
+}
@@ -0,0 +1,235 @@
+#include <atomic>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../my_persistent_map.h"
+#include "gtest/gtest.h"
+
+template <class Key, class T>
+static void ExpectSameContents(const mycontainers::persistent_map<Key, T> &my,
+                               const std::map<Key, T> &std) {
+  ASSERT_EQ(my.size(), std.size());
+  auto stdIt = std.begin();
+  for (auto it = my.begin(); it != my.end(); ++it, ++stdIt) {
+    ASSERT_TRUE(stdIt != std.end());
+    ASSERT_EQ(it->first, stdIt->first);
+    ASSERT_EQ(it->second, stdIt->second);
+  }
+  ASSERT_TRUE(stdIt == std.end());
+}
+
+TEST(persistent_map, constructor) {
+  mycontainers::persistent_map<int, int> myMap;
+  std::map<int, int> stdMap;
+  ASSERT_EQ(myMap.size(), stdMap.size());
+  ASSERT_EQ(myMap.empty(), stdMap.empty());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+}
+
+TEST(persistent_map, constructor_initializer) {
+  mycontainers::persistent_map<int, int> myMap{{3, 30}, {1, 10}, {2, 20}};
+  std::map<int, int> stdMap{{3, 30}, {1, 10}, {2, 20}};
+  ExpectSameContents(myMap, stdMap);
+}
+
+TEST(persistent_map, copy_and_move) {
+  mycontainers::persistent_map<int, int> myMap{{1, 10}, {2, 20}};
+  mycontainers::persistent_map<int, int> copy(myMap);
+  mycontainers::persistent_map<int, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ExpectSameContents(moved, std::map<int, int>{{1, 10}, {2, 20}});
+  mycontainers::persistent_map<int, int> assigned;
+  assigned = moved;
+  moved.insert(3, 30);
+  ExpectSameContents(assigned, std::map<int, int>{{1, 10}, {2, 20}});
+  assigned = std::move(moved);
+  ExpectSameContents(assigned,
+                     std::map<int, int>{{1, 10}, {2, 20}, {3, 30}});
+}
+
+TEST(persistent_map, insert) {
+  mycontainers::persistent_map<std::string, int> myMap;
+  std::map<std::string, int> stdMap;
+  auto myRes = myMap.insert("b", 2);
+  auto stdRes = stdMap.insert({"b", 2});
+  ASSERT_EQ(myRes.second, stdRes.second);
+  ASSERT_EQ(myRes.first->first, stdRes.first->first);
+  ASSERT_EQ(myMap.insert({"a", 1}).second, stdMap.insert({"a", 1}).second);
+  myRes = myMap.insert("b", 3);
+  stdRes = stdMap.insert({"b", 3});
+  ASSERT_EQ(myRes.second, stdRes.second);
+  ASSERT_EQ(myRes.first->second, stdRes.first->second);
+  ExpectSameContents(myMap, stdMap);
+}
+
+TEST(persistent_map, insert_or_assign) {
+  mycontainers::persistent_map<int, int> myMap{{1, 10}};
+  std::map<int, int> stdMap{{1, 10}};
+  ASSERT_EQ(myMap.insert_or_assign(1, 11).second,
+            stdMap.insert_or_assign(1, 11).second);
+  ASSERT_EQ(myMap.insert_or_assign(2, 20).second,
+            stdMap.insert_or_assign(2, 20).second);
+  ASSERT_EQ(myMap.at(1), 11);
+  ExpectSameContents(myMap, stdMap);
+}
+
+TEST(persistent_map, at_find_contains) {
+  mycontainers::persistent_map<int, int> myMap{{1, 10}, {5, 50}};
+  ASSERT_EQ(myMap.at(5), 50);
+  ASSERT_THROW(myMap.at(4), std::out_of_range);
+  ASSERT_EQ(myMap.find(1)->second, 10);
+  ASSERT_TRUE(myMap.find(4) == myMap.end());
+  ASSERT_TRUE(myMap.contains(5));
+  ASSERT_FALSE(myMap.contains(2));
+}
+
+TEST(persistent_map, iterators) {
+  mycontainers::persistent_map<int, int> myMap{{1, 10}, {2, 20}, {3, 30}};
+  auto it = myMap.end();
+  --it;
+  ASSERT_EQ(it->first, 3);
+  --it;
+  --it;
+  ASSERT_TRUE(it == myMap.begin());
+  ++it;
+  ASSERT_EQ((*it).second, 20);
+  auto found = myMap.find(2);
+  ++found;
+  ASSERT_EQ(found->first, 3);
+  ++found;
+  ASSERT_TRUE(found == myMap.end());
+}
+
+TEST(persistent_map, erase) {
+  mycontainers::persistent_map<int, int> myMap;
+  std::map<int, int> stdMap;
+  for (int i = 0; i < 1000; ++i) {
+    myMap.insert(i, -i);
+    stdMap.insert({i, -i});
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    ASSERT_EQ(myMap.erase(i), stdMap.erase(i));
+  }
+  ASSERT_EQ(myMap.erase(3), stdMap.erase(3));
+  myMap.erase(myMap.begin());
+  stdMap.erase(stdMap.begin());
+  ExpectSameContents(myMap, stdMap);
+  myMap.clear();
+  ASSERT_TRUE(myMap.empty());
+  ASSERT_TRUE(myMap.begin() == myMap.end());
+}
+
+TEST(persistent_map, swap) {
+  mycontainers::persistent_map<int, int> first{{1, 10}};
+  mycontainers::persistent_map<int, int> second{{2, 20}, {3, 30}};
+  first.swap(second);
+  ASSERT_EQ(first.size(), 2U);
+  ASSERT_EQ(second.size(), 1U);
+  ASSERT_EQ(second.at(1), 10);
+}
+
+// Counts live copies and throws from the copy constructor once the budget
+// of allowed copies runs out.
+struct ThrowingValue {
+  static int live;
+  static int budget;
+
+  explicit ThrowingValue(int v) : value(v) { ++live; }
+  ThrowingValue(const ThrowingValue &other) : value(other.value) {
+    if (budget == 0) throw std::runtime_error("copy");
+    if (budget > 0) --budget;
+    ++live;
+  }
+  ~ThrowingValue() { --live; }
+
+  int value;
+};
+
+int ThrowingValue::live = 0;
+int ThrowingValue::budget = -1;
+
+TEST(persistent_map, failed_copy_keeps_map) {
+  {
+    mycontainers::persistent_map<int, ThrowingValue> myMap;
+    for (int i = 0; i < 200; ++i) myMap.insert(i, ThrowingValue(i));
+    int live = ThrowingValue::live;
+    for (int budget = 0; budget < 12; ++budget) {
+      ThrowingValue::budget = budget;
+      try {
+        myMap.insert(1000 + budget, ThrowingValue(budget));
+        ThrowingValue::budget = -1;
+        myMap.erase(1000 + budget);
+      } catch (const std::runtime_error &) {
+      }
+      ThrowingValue::budget = budget;
+      try {
+        myMap.erase(budget * 7);
+        ThrowingValue::budget = -1;
+        myMap.insert(budget * 7, ThrowingValue(budget * 7));
+      } catch (const std::runtime_error &) {
+      }
+      ThrowingValue::budget = -1;
+      ASSERT_EQ(myMap.size(), 200U);
+      ASSERT_EQ(ThrowingValue::live, live);
+    }
+    for (int i = 0; i < 200; ++i) ASSERT_EQ(myMap.at(i).value, i);
+  }
+  ASSERT_EQ(ThrowingValue::live, 0);
+}
+
+TEST(persistent_map, snapshot_isolation) {
+  mycontainers::persistent_map<int, int> myMap;
+  std::map<int, int> stdMap;
+  std::vector<mycontainers::persistent_map<int, int>> versions;
+  std::vector<std::map<int, int>> expected;
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> keys(0, 200);
+  for (int i = 0; i < 2000; ++i) {
+    int key = keys(gen);
+    if (gen() % 3 == 0) {
+      myMap.erase(key);
+      stdMap.erase(key);
+    } else {
+      myMap.insert_or_assign(key, i);
+      stdMap.insert_or_assign(key, i);
+    }
+    if (i % 100 == 0) {
+      versions.push_back(myMap.snapshot());
+      expected.push_back(stdMap);
+    }
+  }
+  ExpectSameContents(myMap, stdMap);
+  for (size_t i = 0; i < versions.size(); ++i) {
+    ExpectSameContents(versions[i], expected[i]);
+  }
+}
+
+TEST(persistent_map, snapshot_readers) {
+  mycontainers::persistent_map<int, int> myMap;
+  for (int i = 0; i < 1000; ++i) myMap.insert(i, i);
+  std::atomic<bool> failed(false);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([snapshot = myMap.snapshot(), &failed] {
+      for (int round = 0; round < 20; ++round) {
+        int expected = 0;
+        for (auto it = snapshot.begin(); it != snapshot.end(); ++it) {
+          if (it->first != expected || it->second != expected) failed = true;
+          ++expected;
+        }
+        if (expected != 1000) failed = true;
+      }
+    });
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    myMap.erase(i);
+    myMap.insert_or_assign(i + 1, -i);
+  }
+  for (auto &reader : readers) reader.join();
+  ASSERT_FALSE(failed);
+  ASSERT_EQ(myMap.size(), 500U);
+}
@@ -0,0 +1,129 @@
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../my_priority_queue.h"
+#include "gtest/gtest.h"
+
+template <class StdQueue, class MyQueue>
+static void ExpectSameOrder(StdQueue &stdQueue, MyQueue &myQueue) {
+  ASSERT_EQ(stdQueue.size(), myQueue.size());
+  while (!stdQueue.empty()) {
+    ASSERT_EQ(stdQueue.top(), myQueue.top());
+    stdQueue.pop();
+    myQueue.pop();
+  }
+  ASSERT_TRUE(myQueue.empty());
+}
+
+template <size_t D>
+static void CheckRandomOperations() {
+  std::mt19937 rng(D);
+  std::priority_queue<int> stdQueue;
+  mycontainers::priority_queue<int, std::less<int>, D> myQueue;
+  for (int i = 0; i < 5000; ++i) {
+    if (rng() % 3 && !stdQueue.empty()) {
+      ASSERT_EQ(stdQueue.top(), myQueue.top());
+      stdQueue.pop();
+      myQueue.pop();
+    } else {
+      int value = int(rng() % 1000);
+      stdQueue.push(value);
+      myQueue.push(value);
+    }
+    ASSERT_EQ(stdQueue.size(), myQueue.size());
+  }
+  ExpectSameOrder(stdQueue, myQueue);
+}
+
+TEST(priority_queue, random_operations) {
+  CheckRandomOperations<2>();
+  CheckRandomOperations<3>();
+  CheckRandomOperations<4>();
+  CheckRandomOperations<8>();
+}
+
+TEST(priority_queue, constructors) {
+  mycontainers::priority_queue<int> myQueue{5, 1, 9, 3, 7};
+  std::vector<int> values{5, 1, 9, 3, 7};
+  std::priority_queue<int> stdQueue(values.begin(), values.end());
+  EXPECT_EQ(decltype(myQueue)::arity, 4u);
+  mycontainers::priority_queue<int> copy(myQueue);
+  ExpectSameOrder(stdQueue, myQueue);
+
+  mycontainers::priority_queue<int> moved(std::move(copy));
+  EXPECT_EQ(moved.top(), 9);
+  myQueue = moved;
+  EXPECT_EQ(myQueue.size(), 5u);
+  myQueue.pop();
+  myQueue.swap(moved);
+  EXPECT_EQ(myQueue.size(), 5u);
+  EXPECT_EQ(moved.top(), 7);
+
+  mycontainers::priority_queue<int> empty;
+  empty.pop();
+  EXPECT_TRUE(empty.empty());
+  EXPECT_THROW(empty.top(), std::out_of_range);
+}
+
+TEST(priority_queue, push_range) {
+  std::mt19937 rng(7);
+  std::priority_queue<int, std::vector<int>, std::greater<int>> stdQueue;
+  mycontainers::priority_queue<int, std::greater<int>> myQueue;
+  // Small ranges are sifted in, large ones trigger a rebuild.
+  for (int size : {1, 3, 1000, 2, 50, 5000}) {
+    std::vector<int> values(size);
+    for (int &value : values) value = int(rng() % 10000);
+    for (int value : values) stdQueue.push(value);
+    myQueue.push_range(values.begin(), values.end());
+    ASSERT_EQ(stdQueue.top(), myQueue.top());
+  }
+  ExpectSameOrder(stdQueue, myQueue);
+}
+
+TEST(priority_queue, emplace_and_compare) {
+  auto later = [](const std::pair<int, std::string> &a,
+                  const std::pair<int, std::string> &b) {
+    return a.first > b.first;
+  };
+  mycontainers::priority_queue<std::pair<int, std::string>, decltype(later),
+                               3>
+      myQueue(later);
+  myQueue.emplace(30, "c");
+  myQueue.emplace(10, std::string(40, 'a'));
+  myQueue.emplace(20, "b");
+  std::pair<int, std::string> value(5, "first");
+  myQueue.push(value);
+  EXPECT_EQ(myQueue.top().second, "first");
+  myQueue.pop();
+  EXPECT_EQ(myQueue.top().second, std::string(40, 'a'));
+  myQueue.pop();
+  EXPECT_EQ(myQueue.top().first, 20);
+}
+
+// Every pop, including the last one, must release the element it removes.
+TEST(priority_queue, pop_releases_elements) {
+  auto lower = [](const std::shared_ptr<int> &a,
+                  const std::shared_ptr<int> &b) { return *a < *b; };
+  std::vector<std::shared_ptr<int>> owned;
+  mycontainers::priority_queue<std::shared_ptr<int>, decltype(lower)> myQueue(
+      lower);
+  for (int i = 0; i < 10; ++i) {
+    owned.push_back(std::make_shared<int>(i % 5));
+    myQueue.push(owned.back());
+  }
+  long total = 0;
+  for (const auto &item : owned) total += item.use_count();
+  EXPECT_EQ(total, 20);
+  while (!myQueue.empty()) {
+    myQueue.pop();
+    long now = 0;
+    for (const auto &item : owned) now += item.use_count();
+    EXPECT_EQ(now, --total);
+  }
+  for (const auto &item : owned) EXPECT_EQ(item.use_count(), 1);
+}
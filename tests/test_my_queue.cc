@@ -1,5 +1,12 @@
+#include <deque>
+#include <iterator>
+#include <list>
 #include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
 
+#include "../my_list.h"
 #include "../my_queue.h"
 #include "gtest/gtest.h"
 
@@ -219,4 +226,101 @@ TEST_F(QueueTest2, TestQueueIntConst) {
     EXPECT_EQ(stdQueue2.back(), myQueue2.back());
     EXPECT_EQ(stdQueue2.front(), myQueue2.front());
   }
-}
\ No newline at end of file
+}
+
+template <class Container>
+void CheckQueueContainer() {
+  std::queue<int> stdQueue;
+  mycontainers::MyQueue<int, Container> myQueue;
+  for (int i = 0; i < 100; ++i) {
+    stdQueue.push(i);
+    myQueue.push(i);
+    if (i % 3 == 2) {
+      stdQueue.pop();
+      myQueue.pop();
+    }
+    ASSERT_EQ(stdQueue.size(), myQueue.size());
+    ASSERT_EQ(stdQueue.front(), myQueue.front());
+    ASSERT_EQ(stdQueue.back(), myQueue.back());
+  }
+  myQueue.insert_many_back(1, 2, 3);
+  EXPECT_EQ(myQueue.back(), 3);
+  while (!myQueue.empty()) myQueue.pop();
+  myQueue.pop();
+  EXPECT_EQ(myQueue.size(), 0u);
+}
+
+TEST(QueueContainerTest, ring_buffer_list_and_std_deque) {
+  CheckQueueContainer<mycontainers::ring_buffer<int>>();
+  CheckQueueContainer<mycontainers::list<int>>();
+
+  mycontainers::MyQueue<int, std::deque<int>> queue(std::deque<int>{1, 2});
+  EXPECT_EQ(queue.front(), 1);
+  queue.pop();
+  EXPECT_EQ(queue.front(), 2);
+}
+
+template <class Container>
+void CheckQueuePopValue() {
+  mycontainers::MyQueue<std::string, Container> myQueue;
+  std::string items[] = {"one", "two", "three", "four", "five"};
+  myQueue.push_range(items, items + 5);
+  myQueue.push_range(items, items);
+  ASSERT_EQ(myQueue.size(), 5u);
+  EXPECT_EQ(myQueue.back(), "five");
+  myQueue.front() += "!";
+  EXPECT_EQ(myQueue.pop_value(), "one!");
+  std::optional<std::string> value = myQueue.try_pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(*value, "two");
+
+  std::vector<std::string> out(5);
+  EXPECT_EQ(myQueue.pop_n(out.begin(), 2), 2u);
+  EXPECT_EQ(out[0], "three");
+  EXPECT_EQ(out[1], "four");
+  EXPECT_EQ(myQueue.pop_n(out.begin() + 2, 3), 1u);
+  EXPECT_EQ(out[2], "five");
+  EXPECT_TRUE(myQueue.empty());
+  EXPECT_EQ(myQueue.pop_n(out.begin(), 3), 0u);
+  EXPECT_FALSE(myQueue.try_pop().has_value());
+  EXPECT_THROW(myQueue.pop_value(), std::out_of_range);
+}
+
+TEST(QueuePopValueTest, ring_buffer_list_and_std_deque) {
+  CheckQueuePopValue<mycontainers::ring_buffer<std::string>>();
+  CheckQueuePopValue<mycontainers::list<std::string>>();
+  CheckQueuePopValue<std::deque<std::string>>();
+
+  // Wraps around the ring before the range is appended.
+  mycontainers::MyQueue<int> queue{0, 1, 2, 3, 4, 5, 6};
+  for (int i = 0; i < 5; ++i) queue.pop();
+  int items[] = {7, 8, 9, 10, 11, 12};
+  queue.push_range(items, items + 6);
+  std::vector<int> out(8);
+  EXPECT_EQ(queue.pop_n(out.begin(), 8), 8u);
+  EXPECT_EQ(out, (std::vector<int>{5, 6, 7, 8, 9, 10, 11, 12}));
+}
+
+// A deque that records the capacities requested from it.
+struct ReserveRecordingDeque : std::deque<int> {
+  void reserve(size_t n) { reserved->push_back(n); }
+  std::vector<size_t> *reserved;
+};
+
+TEST(QueuePushRangeTest, reserves_for_forward_iterators) {
+  std::vector<size_t> reserved;
+  ReserveRecordingDeque container;
+  container.reserved = &reserved;
+  mycontainers::MyQueue<int, ReserveRecordingDeque> queue(container);
+  queue.push(0);
+  std::list<int> items{1, 2, 3, 4};
+  queue.push_range(items.begin(), items.end());
+  EXPECT_EQ(reserved, std::vector<size_t>{5});
+  // An input range can be walked only once, so it is not counted.
+  std::istringstream input("5 6");
+  queue.push_range(std::istream_iterator<int>(input),
+                   std::istream_iterator<int>());
+  EXPECT_EQ(reserved.size(), 1u);
+  EXPECT_EQ(queue.size(), 7u);
+  EXPECT_EQ(queue.back(), 6);
+}
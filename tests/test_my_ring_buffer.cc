@@ -0,0 +1,126 @@
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../my_ring_buffer.h"
+#include "gtest/gtest.h"
+
+template <class T>
+static void ExpectSameElements(const std::deque<T> &stdDeque,
+                               const mycontainers::ring_buffer<T> &myBuffer) {
+  ASSERT_EQ(stdDeque.size(), myBuffer.size());
+  ASSERT_EQ(stdDeque.empty(), myBuffer.empty());
+  auto myIt = myBuffer.cbegin();
+  for (const T &value : stdDeque) {
+    ASSERT_EQ(value, *myIt);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myBuffer.cend());
+  if (!stdDeque.empty()) {
+    ASSERT_EQ(stdDeque.front(), myBuffer.front());
+    ASSERT_EQ(stdDeque.back(), myBuffer.back());
+  }
+}
+
+TEST(ring_buffer, constructors) {
+  mycontainers::ring_buffer<std::string> myBuffer{"a", "b", "c"};
+  std::deque<std::string> stdDeque{"a", "b", "c"};
+  ExpectSameElements(stdDeque, myBuffer);
+  ASSERT_EQ(myBuffer.capacity(), 8U);
+
+  mycontainers::ring_buffer<std::string> myCopy(myBuffer);
+  ExpectSameElements(stdDeque, myCopy);
+  mycontainers::ring_buffer<std::string> myMoved(std::move(myCopy));
+  ExpectSameElements(stdDeque, myMoved);
+  ASSERT_TRUE(myCopy.empty());
+  ASSERT_EQ(myCopy.capacity(), 0U);
+  myCopy = myMoved;
+  myMoved = std::move(myBuffer);
+  ExpectSameElements(stdDeque, myCopy);
+  ExpectSameElements(stdDeque, myMoved);
+}
+
+TEST(ring_buffer, power_of_two_capacity) {
+  mycontainers::ring_buffer<int> myBuffer;
+  ASSERT_EQ(myBuffer.capacity(), 0U);
+  myBuffer.reserve(100);
+  ASSERT_EQ(myBuffer.capacity(), 128U);
+  for (int i = 0; i < 129; ++i) myBuffer.push_back(i);
+  ASSERT_EQ(myBuffer.capacity(), 256U);
+  for (int i = 0; i < 100; ++i) myBuffer.pop_front();
+  myBuffer.shrink_to_fit();
+  ASSERT_EQ(myBuffer.capacity(), 32U);
+  ASSERT_EQ(myBuffer.front(), 100);
+  ASSERT_EQ(myBuffer.at(28), 128);
+  ASSERT_THROW(myBuffer.at(29), std::out_of_range);
+  myBuffer.clear();
+  myBuffer.shrink_to_fit();
+  ASSERT_EQ(myBuffer.capacity(), 0U);
+}
+
+TEST(ring_buffer, wraps_without_allocating) {
+  mycontainers::ring_buffer<int> myBuffer;
+  std::deque<int> stdDeque;
+  for (int i = 0; i < 6; ++i) {
+    myBuffer.push_back(i);
+    stdDeque.push_back(i);
+  }
+  for (int i = 6; i < 1000; ++i) {
+    myBuffer.push_back(i);
+    myBuffer.pop_front();
+    stdDeque.push_back(i);
+    stdDeque.pop_front();
+  }
+  ASSERT_EQ(myBuffer.capacity(), 8U);
+  ExpectSameElements(stdDeque, myBuffer);
+}
+
+TEST(ring_buffer, random_operations) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> ops(0, 5);
+  mycontainers::ring_buffer<std::string> myBuffer;
+  std::deque<std::string> stdDeque;
+  for (int i = 0; i < 5000; ++i) {
+    std::string value = std::to_string(i);
+    switch (ops(gen)) {
+      case 0:
+      case 1:
+        myBuffer.push_back(value);
+        stdDeque.push_back(value);
+        break;
+      case 2:
+        myBuffer.push_front(value);
+        stdDeque.push_front(value);
+        break;
+      case 3:
+        myBuffer.pop_front();
+        if (!stdDeque.empty()) stdDeque.pop_front();
+        break;
+      case 4:
+        myBuffer.pop_back();
+        if (!stdDeque.empty()) stdDeque.pop_back();
+        break;
+      default:
+        if (!stdDeque.empty()) {
+          myBuffer.push_back(myBuffer.front());
+          stdDeque.push_back(stdDeque.front());
+        }
+    }
+    ASSERT_EQ(myBuffer.size(), stdDeque.size());
+  }
+  ExpectSameElements(stdDeque, myBuffer);
+}
+
+TEST(ring_buffer, push_aliased_element_while_growing) {
+  mycontainers::ring_buffer<std::string> myBuffer;
+  for (int i = 0; i < 8; ++i) myBuffer.push_back(std::string(20, 'a' + i));
+  myBuffer.push_back(myBuffer.front());
+  myBuffer.push_front(myBuffer.back());
+  ASSERT_EQ(myBuffer.size(), 10U);
+  ASSERT_EQ(myBuffer.front(), std::string(20, 'a'));
+  ASSERT_EQ(myBuffer.back(), std::string(20, 'a'));
+  myBuffer.insert_many_back(myBuffer[1], std::string("z"));
+  ASSERT_EQ(myBuffer[10], std::string(20, 'a'));
+  ASSERT_EQ(myBuffer.back(), "z");
+}
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+
 #include "../my_set.h"
 #include "gtest/gtest.h"
 
@@ -5,7 +11,7 @@ class SetTest1 : public testing::Test {
  protected:
   void TearDown() override {
     EXPECT_EQ(stdSet.size(), mySet.size());
-    EXPECT_EQ(stdSet.max_size(), mySet.max_size());
+    EXPECT_LE(stdSet.max_size(), mySet.max_size());
     EXPECT_EQ(stdSet.empty(), mySet.empty());
 
     EXPECT_EQ(*stdSet.begin(), *mySet.begin());
@@ -48,7 +54,7 @@ TEST_F(SetTest1, TestSetIntCopy) {
   mySet = mySet2;
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -66,7 +72,7 @@ TEST_F(SetTest1, TestSetIntMove) {
   mySet = mySet2;
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -81,7 +87,7 @@ TEST_F(SetTest1, TestSetIntCopyOp) {
   mySet = mySet1;
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -96,7 +102,7 @@ TEST_F(SetTest1, TestSetIntMoveOp) {
   mySet = std::move(mySet1);
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -333,7 +339,7 @@ TEST_F(SetTest1, TestSetIntSwap) {
   mySet.swap(mySet1);
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -355,7 +361,7 @@ TEST_F(SetTest1, TestSetIntMerge1) {
   mySet.merge(mySet1);
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -373,7 +379,7 @@ TEST_F(SetTest1, TestSetIntMerge2) {
   mySet.merge(mySet1);
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -394,7 +400,7 @@ TEST_F(SetTest1, TestSetIntMerge3) {
   mySet.merge(mySet1);
 
   EXPECT_EQ(stdSet1.size(), mySet1.size());
-  EXPECT_EQ(stdSet1.max_size(), mySet1.max_size());
+  EXPECT_LE(stdSet1.max_size(), mySet1.max_size());
   EXPECT_EQ(stdSet1.empty(), mySet1.empty());
   EXPECT_EQ(*stdSet1.begin(), *mySet1.begin());
   EXPECT_EQ(*stdSet1.end(), *mySet1.end());
@@ -406,7 +412,7 @@ TEST(SetTest, TestSetIntConst) {
   const mycontainers::MySet<int> mySet(items);
 
   EXPECT_EQ(stdSet.size(), mySet.size());
-  EXPECT_EQ(stdSet.max_size(), mySet.max_size());
+  EXPECT_LE(stdSet.max_size(), mySet.max_size());
   EXPECT_EQ(stdSet.empty(), mySet.empty());
 
   for (auto &i : items) {
@@ -502,7 +508,7 @@ TEST(SetTest, TestSetDoubleIterator) {
   mycontainers::MySet<double> mySet(items);
 
   EXPECT_EQ(stdSet.size(), mySet.size());
-  EXPECT_EQ(stdSet.max_size(), mySet.max_size());
+  EXPECT_LE(stdSet.max_size(), mySet.max_size());
   EXPECT_EQ(stdSet.empty(), mySet.empty());
 
   EXPECT_EQ(*stdSet.begin(), *mySet.begin());
@@ -529,7 +535,7 @@ TEST(SetTest, TestSetCharIterator) {
   mycontainers::MySet<char> mySet(items);
 
   EXPECT_EQ(stdSet.size(), mySet.size());
-  EXPECT_EQ(stdSet.max_size(), mySet.max_size());
+  EXPECT_LE(stdSet.max_size(), mySet.max_size());
   EXPECT_EQ(stdSet.empty(), mySet.empty());
 
   EXPECT_EQ(*stdSet.begin(), *mySet.begin());
@@ -556,7 +562,7 @@ TEST(SetTest, TestSetBoolIterator) {
   mycontainers::MySet<bool> mySet(items);
 
   EXPECT_EQ(stdSet.size(), mySet.size());
-  EXPECT_EQ(stdSet.max_size(), mySet.max_size());
+  EXPECT_LE(stdSet.max_size(), mySet.max_size());
   EXPECT_EQ(stdSet.empty(), mySet.empty());
 
   EXPECT_EQ(*stdSet.begin(), *mySet.begin());
@@ -602,3 +608,194 @@ TEST(SetTest, TestSetStringIterator) {
     EXPECT_EQ(*stdIt, *myIt);
   }
 }
+
+TEST(SetTest, TestSetIntInsertEraseMany) {
+  std::set<int> stdSet;
+  mycontainers::MySet<int> mySet;
+
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 1009;
+    stdSet.insert(key);
+    mySet.insert(key);
+    if (i % 3 == 0) {
+      key = (i * 104729) % 1009;
+      if (stdSet.count(key)) {
+        stdSet.erase(key);
+        mySet.erase(mySet.find(key));
+      }
+    }
+  }
+
+  EXPECT_EQ(stdSet.size(), mySet.size());
+
+  std::set<int>::iterator stdIt = stdSet.begin();
+  mycontainers::MySet<int>::iterator myIt = mySet.begin();
+  for (; stdIt != stdSet.end(); ++stdIt, ++myIt) {
+    EXPECT_EQ(*stdIt, *myIt);
+  }
+  EXPECT_TRUE(myIt == mySet.end());
+}
+
+static void FillSets(std::set<int> &stdSet, mycontainers::MySet<int> &mySet,
+                     int count, int range, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> keys(0, range);
+  for (int i = 0; i < count; ++i) {
+    int key = keys(gen);
+    stdSet.insert(key);
+    mySet.insert(key);
+  }
+}
+
+static void ExpectSameSet(const std::set<int> &stdSet,
+                          mycontainers::MySet<int> &mySet) {
+  EXPECT_EQ(stdSet.size(), mySet.size());
+  mycontainers::MySet<int>::iterator myIt = mySet.begin();
+  for (int key : stdSet) {
+    EXPECT_EQ(key, *myIt);
+    ++myIt;
+  }
+  EXPECT_TRUE(myIt == mySet.end());
+}
+
+TEST(SetTest, TestSetIntSetAlgebra) {
+  const int sizes[][2] = {{0, 50}, {50, 0}, {1, 1000}, {1000, 3},
+                          {700, 900}, {3000, 40}};
+  unsigned seed = 1;
+  for (auto &size : sizes) {
+    for (int operation = 0; operation < 3; ++operation) {
+      std::set<int> stdFirst, stdSecond, stdResult;
+      mycontainers::MySet<int> myFirst, mySecond;
+      FillSets(stdFirst, myFirst, size[0], 2000, ++seed);
+      FillSets(stdSecond, mySecond, size[1], 2000, ++seed);
+      auto out = std::inserter(stdResult, stdResult.end());
+      if (operation == 0) {
+        std::set_union(stdFirst.begin(), stdFirst.end(), stdSecond.begin(),
+                       stdSecond.end(), out);
+        myFirst.set_union(mySecond);
+      } else if (operation == 1) {
+        std::set_intersection(stdFirst.begin(), stdFirst.end(),
+                              stdSecond.begin(), stdSecond.end(), out);
+        myFirst.set_intersection(mySecond);
+      } else {
+        std::set_difference(stdFirst.begin(), stdFirst.end(),
+                            stdSecond.begin(), stdSecond.end(), out);
+        myFirst.set_difference(mySecond);
+      }
+      EXPECT_TRUE(mySecond.empty());
+      ExpectSameSet(stdResult, myFirst);
+
+      for (int key = -5; key < 2005; key += 7) {
+        stdResult.insert(key);
+        myFirst.insert(key);
+      }
+      for (int key = 0; key < 2000; key += 3) {
+        if (stdResult.erase(key)) myFirst.erase(myFirst.find(key));
+      }
+      ExpectSameSet(stdResult, myFirst);
+    }
+  }
+}
+
+TEST(SetTest, TestSetIntSetAlgebraSelf) {
+  std::set<int> stdSet;
+  mycontainers::MySet<int> mySet;
+  FillSets(stdSet, mySet, 500, 2000, 13);
+  mySet.set_union(mySet);
+  ExpectSameSet(stdSet, mySet);
+  mySet.set_intersection(mySet);
+  ExpectSameSet(stdSet, mySet);
+  mySet.set_difference(mySet);
+  EXPECT_TRUE(mySet.empty());
+  ExpectSameSet(std::set<int>(), mySet);
+  mySet.insert(7);
+  EXPECT_EQ(mySet.size(), 1u);
+}
+
+TEST(SetTest, TestSetIntSetAlgebraParallel) {
+  std::set<int> stdFirst, stdSecond, stdUnion, stdIntersection;
+  mycontainers::MySet<int> myFirst, mySecond, myCopy, mySecondCopy;
+  FillSets(stdFirst, myFirst, 100000, 400000, 11);
+  FillSets(stdSecond, mySecond, 60000, 400000, 12);
+  myCopy = myFirst;
+  mySecondCopy = mySecond;
+
+  std::set_union(stdFirst.begin(), stdFirst.end(), stdSecond.begin(),
+                 stdSecond.end(), std::inserter(stdUnion, stdUnion.end()));
+  myFirst.set_union(mySecond, true);
+  ExpectSameSet(stdUnion, myFirst);
+
+  std::set_intersection(stdFirst.begin(), stdFirst.end(), stdSecond.begin(),
+                        stdSecond.end(),
+                        std::inserter(stdIntersection, stdIntersection.end()));
+  myCopy.set_intersection(mySecondCopy, true);
+  ExpectSameSet(stdIntersection, myCopy);
+}
+
+TEST(SetTest, TestSetIntSplit) {
+  std::set<int> stdSet;
+  mycontainers::MySet<int> mySet;
+  FillSets(stdSet, mySet, 1000, 3000, 21);
+
+  for (int key : {1500, -1, 5000, 700}) {
+    std::set<int> stdGreater(stdSet.lower_bound(key), stdSet.end());
+    stdSet.erase(stdSet.lower_bound(key), stdSet.end());
+    mycontainers::MySet<int> myGreater = mySet.split(key);
+    ExpectSameSet(stdSet, mySet);
+    ExpectSameSet(stdGreater, myGreater);
+    stdSet.insert(stdGreater.begin(), stdGreater.end());
+    mySet.merge(myGreater);
+    ExpectSameSet(stdSet, mySet);
+  }
+}
+
+TEST(SetTest, TestSetIntMergeLeftovers) {
+  std::set<int> stdFirst, stdSecond;
+  mycontainers::MySet<int> myFirst, mySecond;
+  FillSets(stdFirst, myFirst, 500, 1000, 31);
+  FillSets(stdSecond, mySecond, 500, 1000, 32);
+
+  stdFirst.merge(stdSecond);
+  myFirst.merge(mySecond);
+  ExpectSameSet(stdFirst, myFirst);
+  ExpectSameSet(stdSecond, mySecond);
+}
+
+TEST(SetTest, TestSetIntEraseIf) {
+  for (int count : {0, 1, 2, 3, 100, 1000}) {
+    std::set<int> stdSet;
+    mycontainers::MySet<int> mySet;
+    FillSets(stdSet, mySet, count, 3000, count + 41);
+    auto odd = [](int key) { return key % 2 != 0; };
+    size_t erased = stdSet.size();
+    for (auto it = stdSet.begin(); it != stdSet.end();) {
+      it = odd(*it) ? stdSet.erase(it) : std::next(it);
+    }
+    erased -= stdSet.size();
+    ASSERT_EQ(mycontainers::erase_if(mySet, odd), erased);
+    ExpectSameSet(stdSet, mySet);
+
+    FillSets(stdSet, mySet, count, 3000, count + 42);
+    for (int key = 0; key < 3000; key += 7) {
+      stdSet.erase(key);
+      mySet.erase(mySet.find(key));
+    }
+    ExpectSameSet(stdSet, mySet);
+  }
+}
+
+TEST(SetTest, TestSetIntRemoveIfThrowingPredicate) {
+  std::set<int> stdSet;
+  mycontainers::MySet<int> mySet;
+  FillSets(stdSet, mySet, 200, 1000, 43);
+  int middle = *std::next(stdSet.begin(), 100);
+  auto pred = [middle](int key) {
+    if (key == middle) throw std::runtime_error("stop");
+    return key % 3 == 0;
+  };
+  ASSERT_THROW(mySet.remove_if(pred), std::runtime_error);
+  for (auto it = stdSet.begin(); *it != middle;) {
+    it = *it % 3 == 0 ? stdSet.erase(it) : std::next(it);
+  }
+  ExpectSameSet(stdSet, mySet);
+}
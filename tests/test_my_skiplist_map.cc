@@ -0,0 +1,104 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../my_skiplist_map.h"
+#include "gtest/gtest.h"
+
+template <class Key, class T>
+static void ExpectSameMap(const std::map<Key, T> &stdMap,
+                          const mycontainers::skiplist_map<Key, T> &myMap) {
+  ASSERT_EQ(stdMap.size(), myMap.size());
+  auto myIt = myMap.begin();
+  for (const auto &[key, value] : stdMap) {
+    ASSERT_EQ(key, myIt->first);
+    ASSERT_EQ(value, myIt->second);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myMap.end());
+}
+
+TEST(SkiplistMapTest, ElementAccess) {
+  mycontainers::skiplist_map<int, std::string> myMap{{2, "two"}, {1, "one"}};
+  std::map<int, std::string> stdMap{{2, "two"}, {1, "one"}};
+  ASSERT_EQ(myMap.at(2), "two");
+  ASSERT_THROW(myMap.at(3), std::out_of_range);
+  myMap[3] = "three";
+  stdMap[3] = "three";
+  myMap[1] += "!";
+  stdMap[1] += "!";
+  ExpectSameMap(stdMap, myMap);
+
+  auto result = myMap.insert_or_assign(2, "TWO");
+  ASSERT_FALSE(result.second);
+  ASSERT_EQ(result.first->second, "TWO");
+  ASSERT_TRUE(myMap.insert_or_assign(0, "zero").second);
+  ASSERT_FALSE(myMap.insert(0, "none").second);
+  stdMap.insert_or_assign(2, "TWO");
+  stdMap.insert_or_assign(0, "zero");
+  ExpectSameMap(stdMap, myMap);
+}
+
+struct CountedValue {
+  CountedValue() { ++constructed; }
+  CountedValue(const CountedValue &other) : value(other.value) {}
+  CountedValue &operator=(const CountedValue &) = default;
+
+  static int constructed;
+  int value = 0;
+};
+
+int CountedValue::constructed = 0;
+
+TEST(SkiplistMapTest, SubscriptConstructsOnlyOnMiss) {
+  mycontainers::skiplist_map<int, CountedValue> myMap;
+  CountedValue::constructed = 0;
+  myMap[1].value = 10;
+  ASSERT_EQ(CountedValue::constructed, 1);
+  myMap[1].value += 5;
+  ASSERT_EQ(myMap[1].value, 15);
+  ASSERT_EQ(CountedValue::constructed, 1);
+  ASSERT_EQ(myMap.size(), 1u);
+}
+
+TEST(SkiplistMapTest, RandomOperations) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> keys(0, 500);
+  std::map<int, int> stdMap;
+  mycontainers::skiplist_map<int, int> myMap(0.5);
+  for (int i = 0; i < 3000; ++i) {
+    int key = keys(gen);
+    if (i % 4 == 3) {
+      auto it = myMap.find(key);
+      ASSERT_EQ(it != myMap.end(), stdMap.erase(key) == 1);
+      myMap.erase(it);
+    } else {
+      myMap.insert_or_assign(key, i);
+      stdMap.insert_or_assign(key, i);
+    }
+  }
+  ExpectSameMap(stdMap, myMap);
+
+  mycontainers::skiplist_map<int, int> myCopy(myMap);
+  myMap.clear();
+  ExpectSameMap(stdMap, myCopy);
+  int key = stdMap.begin()->first + 1;
+  auto stdIt = stdMap.lower_bound(key);
+  for (auto myIt = myCopy.lower_bound(key); myIt != myCopy.end(); ++myIt) {
+    ASSERT_EQ(myIt->first, stdIt->first);
+    ++stdIt;
+  }
+  ASSERT_TRUE(stdIt == stdMap.end());
+}
+
+TEST(SkiplistMapTest, Merge) {
+  mycontainers::skiplist_map<int, int> myFirst{{1, 1}, {3, 3}};
+  mycontainers::skiplist_map<int, int> mySecond{{2, 20}, {3, 30}};
+  std::map<int, int> stdFirst{{1, 1}, {3, 3}};
+  std::map<int, int> stdSecond{{2, 20}, {3, 30}};
+  myFirst.merge(mySecond);
+  stdFirst.merge(stdSecond);
+  ExpectSameMap(stdFirst, myFirst);
+  ExpectSameMap(stdSecond, mySecond);
+}
@@ -0,0 +1,140 @@
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../my_skiplist_set.h"
+#include "gtest/gtest.h"
+
+template <class Key>
+static void ExpectSameSet(const std::set<Key> &stdSet,
+                          const mycontainers::skiplist_set<Key> &mySet) {
+  ASSERT_EQ(stdSet.size(), mySet.size());
+  ASSERT_EQ(stdSet.empty(), mySet.empty());
+  auto myIt = mySet.begin();
+  for (const Key &key : stdSet) {
+    ASSERT_EQ(key, *myIt);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == mySet.end());
+  for (auto it = stdSet.rbegin(); it != stdSet.rend(); ++it) {
+    --myIt;
+    ASSERT_EQ(*it, *myIt);
+  }
+  ASSERT_TRUE(myIt == mySet.begin());
+}
+
+TEST(SkiplistSetTest, Constructors) {
+  mycontainers::skiplist_set<int> mySet{5, 1, 4, 1, 3};
+  std::set<int> stdSet{5, 1, 4, 1, 3};
+  ExpectSameSet(stdSet, mySet);
+
+  mycontainers::skiplist_set<int> myCopy(mySet);
+  ExpectSameSet(stdSet, myCopy);
+  mycontainers::skiplist_set<int> myMoved(std::move(myCopy));
+  ExpectSameSet(stdSet, myMoved);
+  ASSERT_TRUE(myCopy.empty());
+  myCopy = myMoved;
+  myMoved.clear();
+  ExpectSameSet(stdSet, myCopy);
+  ExpectSameSet(std::set<int>(), myMoved);
+  myMoved.insert(7);
+  ASSERT_TRUE(myMoved.contains(7));
+}
+
+TEST(SkiplistSetTest, LevelProbability) {
+  mycontainers::skiplist_set<int> myDefault;
+  ASSERT_DOUBLE_EQ(myDefault.level_probability(), 0.25);
+  mycontainers::skiplist_set<int> myHalf(0.5);
+  ASSERT_DOUBLE_EQ(myHalf.level_probability(), 0.5);
+  mycontainers::skiplist_set<int> myCopy(myHalf);
+  ASSERT_DOUBLE_EQ(myCopy.level_probability(), 0.5);
+  ASSERT_THROW(mycontainers::skiplist_set<int>(0.0), std::invalid_argument);
+  ASSERT_THROW(mycontainers::skiplist_set<int>(1.0), std::invalid_argument);
+}
+
+TEST(SkiplistSetTest, RandomOperations) {
+  for (double probability : {0.03, 0.25, 0.5, 0.9}) {
+    std::mt19937 gen(int(probability * 100));
+    std::uniform_int_distribution<int> keys(0, 2000);
+    std::set<int> stdSet;
+    mycontainers::skiplist_set<int> mySet(probability);
+    for (int i = 0; i < 5000; ++i) {
+      int key = keys(gen);
+      if (i % 3 == 2) {
+        ASSERT_EQ(mySet.erase(key), stdSet.erase(key));
+      } else {
+        auto result = mySet.insert(key);
+        ASSERT_EQ(result.second, stdSet.insert(key).second);
+        ASSERT_EQ(*result.first, key);
+      }
+    }
+    ExpectSameSet(stdSet, mySet);
+    for (int i = 0; i < 200; ++i) {
+      int key = keys(gen);
+      auto stdLower = stdSet.lower_bound(key);
+      auto myLower = mySet.lower_bound(key);
+      ASSERT_EQ(stdLower == stdSet.end(), myLower == mySet.end());
+      if (stdLower != stdSet.end()) {
+        ASSERT_EQ(*stdLower, *myLower);
+      }
+      auto stdUpper = stdSet.upper_bound(key);
+      auto myUpper = mySet.upper_bound(key);
+      ASSERT_EQ(stdUpper == stdSet.end(), myUpper == mySet.end());
+      if (stdUpper != stdSet.end()) {
+        ASSERT_EQ(*stdUpper, *myUpper);
+      }
+      ASSERT_EQ(stdSet.count(key) == 1, mySet.contains(key));
+      ASSERT_EQ(stdSet.count(key) == 1, mySet.find(key) != mySet.end());
+    }
+    while (!mySet.empty()) {
+      stdSet.erase(stdSet.begin());
+      mySet.erase(mySet.begin());
+    }
+    ExpectSameSet(stdSet, mySet);
+  }
+}
+
+TEST(SkiplistSetTest, Merge) {
+  mycontainers::skiplist_set<std::string> myFirst{"a", "c", "e"};
+  mycontainers::skiplist_set<std::string> mySecond{"b", "c", "d", "f"};
+  std::set<std::string> stdFirst{"a", "c", "e"};
+  std::set<std::string> stdSecond{"b", "c", "d", "f"};
+  myFirst.merge(mySecond);
+  stdFirst.merge(stdSecond);
+  ExpectSameSet(stdFirst, myFirst);
+  ExpectSameSet(stdSecond, mySecond);
+  myFirst.swap(mySecond);
+  ExpectSameSet(stdSecond, myFirst);
+  ExpectSameSet(stdFirst, mySecond);
+}
+
+TEST(SkiplistSetTest, IteratorsAfterSwap) {
+  mycontainers::skiplist_set<int> myFirst{1, 2, 3};
+  mycontainers::skiplist_set<int> mySecond{10, 20};
+  auto it = myFirst.find(2);
+  myFirst.swap(mySecond);
+  ASSERT_EQ(*it, 2);
+  ++it;
+  ASSERT_EQ(*it, 3);
+  ++it;
+  ASSERT_TRUE(it == mySecond.end());
+  // it still belongs to the old list: step back from the new owner's end.
+  auto last = mySecond.end();
+  --last;
+  ASSERT_EQ(*last, 3);
+  auto otherLast = myFirst.end();
+  --otherLast;
+  ASSERT_EQ(*otherLast, 20);
+}
+
+TEST(SkiplistSetTest, InsertMany) {
+  mycontainers::skiplist_set<int> mySet{2};
+  auto result = mySet.insert_many(3, 2, 1);
+  ASSERT_EQ(result.size(), 3U);
+  ASSERT_TRUE(result[0].second);
+  ASSERT_FALSE(result[1].second);
+  ASSERT_EQ(*result[1].first, 2);
+  ExpectSameSet(std::set<int>{1, 2, 3}, mySet);
+}
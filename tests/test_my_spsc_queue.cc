@@ -0,0 +1,119 @@
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../my_spsc_queue.h"
+#include "gtest/gtest.h"
+
+TEST(spsc_queue, constructor) {
+  mycontainers::spsc_queue<int> myQueue(100);
+  EXPECT_EQ(myQueue.capacity(), 128u);
+  EXPECT_TRUE(myQueue.empty());
+  EXPECT_EQ(myQueue.size(), 0u);
+  EXPECT_EQ(mycontainers::spsc_queue<int>(0).capacity(), 1u);
+  EXPECT_THROW(mycontainers::spsc_queue<int>(size_t(-1)), std::length_error);
+}
+
+TEST(spsc_queue, push_pop) {
+  mycontainers::spsc_queue<std::string> myQueue(4);
+  std::queue<std::string> stdQueue;
+  for (int i = 0; i < 50; ++i) {
+    std::string value(20, char('a' + i % 26));
+    bool pushed = myQueue.push(value);
+    ASSERT_EQ(pushed, stdQueue.size() < 4);
+    if (pushed) stdQueue.push(value);
+    if (i % 3 == 2) {
+      myQueue.pop();
+      stdQueue.pop();
+    }
+    ASSERT_EQ(stdQueue.size(), myQueue.size());
+    ASSERT_EQ(stdQueue.front(), myQueue.front());
+  }
+  while (!myQueue.empty()) myQueue.pop();
+  myQueue.pop();
+  EXPECT_EQ(myQueue.size(), 0u);
+  EXPECT_TRUE(myQueue.push(std::string("left for the destructor")));
+}
+
+TEST(spsc_queue, push_n_pop_n) {
+  mycontainers::spsc_queue<int> myQueue(8);
+  std::vector<int> input{1, 2, 3, 4, 5, 6};
+  std::vector<int> output(12);
+  EXPECT_EQ(myQueue.push_n(input.begin(), 6), 6u);
+  EXPECT_EQ(myQueue.pop_n(output.begin(), 4), 4u);
+  // Wraps around the end of the ring and stops when it is full.
+  EXPECT_EQ(myQueue.push_n(input.begin(), 6), 6u);
+  EXPECT_EQ(myQueue.push_n(input.begin(), 6), 0u);
+  EXPECT_EQ(myQueue.size(), 8u);
+  EXPECT_EQ(myQueue.pop_n(output.begin() + 4, 10), 8u);
+  EXPECT_EQ(output,
+            std::vector<int>({1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(myQueue.pop_n(output.begin(), 1), 0u);
+  EXPECT_TRUE(myQueue.empty());
+}
+
+// Moving out of the queue throws once budget assignments have been made.
+struct ThrowingMove {
+  explicit ThrowingMove(const std::string &v = "") : value(v) {}
+  ThrowingMove(const ThrowingMove &) = default;
+  ThrowingMove &operator=(ThrowingMove &&other) {
+    if (budget-- == 0) throw std::runtime_error("move");
+    value = std::move(other.value);
+    return *this;
+  }
+
+  static int budget;
+  std::string value;
+};
+
+int ThrowingMove::budget = 0;
+
+TEST(spsc_queue, pop_n_keeps_elements_after_a_throw) {
+  mycontainers::spsc_queue<ThrowingMove> myQueue(8);
+  std::vector<ThrowingMove> input;
+  for (const char *value : {"one", "two", "three", "four"}) {
+    input.emplace_back(std::string(value) + std::string(20, '!'));
+  }
+  EXPECT_EQ(myQueue.push_n(input.begin(), 4), 4u);
+  std::vector<ThrowingMove> output(4);
+  ThrowingMove::budget = 2;
+  EXPECT_THROW(myQueue.pop_n(output.begin(), 4), std::runtime_error);
+  EXPECT_EQ(output[1].value, input[1].value);
+  ASSERT_EQ(myQueue.size(), 2u);
+  EXPECT_EQ(myQueue.front().value, input[2].value);
+  ThrowingMove::budget = 2;
+  EXPECT_EQ(myQueue.pop_n(output.begin() + 2, 4), 2u);
+  EXPECT_EQ(output[3].value, input[3].value);
+  EXPECT_TRUE(myQueue.empty());
+}
+
+TEST(spsc_queue, threads_keep_order) {
+  mycontainers::spsc_queue<int> myQueue(64);
+  const int kCount = 200000;
+  std::thread producer([&myQueue] {
+    int next = 0;
+    while (next < kCount) {
+      int batch[5];
+      int n = 0;
+      for (; n < 5 && next + n < kCount; ++n) batch[n] = next + n;
+      if (next % 2) {
+        next += int(myQueue.push_n(batch, size_t(n)));
+      } else if (myQueue.push(next)) {
+        ++next;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  while (expected < kCount) {
+    int batch[7];
+    size_t n = myQueue.pop_n(batch, expected % 2 ? 7 : 1);
+    for (size_t i = 0; i < n; ++i) ASSERT_EQ(batch[i], expected++);
+    if (!n) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(myQueue.empty());
+}
@@ -1,5 +1,12 @@
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <vector>
 
+#include "../my_list.h"
 #include "../my_stack.h"
 #include "gtest/gtest.h"
 
@@ -209,3 +216,125 @@ TEST_F(StackTest2, TestStackIntConst) {
     EXPECT_EQ(stdStack2.top(), myStack2.top());
   }
 }
+
+template <class Container>
+void CheckStackContainer() {
+  std::stack<int> stdStack;
+  mycontainers::MyStack<int, Container> myStack;
+  for (int i = 0; i < 100; ++i) {
+    stdStack.push(i);
+    myStack.push(i);
+    if (i % 3 == 2) {
+      stdStack.pop();
+      myStack.pop();
+    }
+    ASSERT_EQ(stdStack.size(), myStack.size());
+    ASSERT_EQ(stdStack.top(), myStack.top());
+  }
+  myStack.insert_many_front(1, 2, 3);
+  EXPECT_EQ(myStack.top(), 3);
+  while (!myStack.empty()) myStack.pop();
+  myStack.pop();
+  EXPECT_EQ(myStack.size(), 0u);
+}
+
+TEST(StackContainerTest, vector_list_and_std_vector) {
+  CheckStackContainer<mycontainers::vector<int>>();
+  CheckStackContainer<mycontainers::list<int>>();
+
+  mycontainers::MyStack<int, std::vector<int>> stack(std::vector<int>{1, 2});
+  EXPECT_EQ(stack.top(), 2);
+  stack.pop();
+  EXPECT_EQ(stack.top(), 1);
+}
+
+template <class Container>
+void CheckStackPopValue() {
+  mycontainers::MyStack<std::string, Container> myStack;
+  std::string items[] = {"one", "two", "three", "four", "five"};
+  myStack.push_range(items, items + 5);
+  myStack.push_range(items, items);
+  ASSERT_EQ(myStack.size(), 5u);
+  EXPECT_EQ(myStack.top(), "five");
+  myStack.top() += "!";
+  EXPECT_EQ(myStack.pop_value(), "five!");
+  std::optional<std::string> value = myStack.try_pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(*value, "four");
+
+  std::vector<std::string> out(5);
+  EXPECT_EQ(myStack.pop_n(out.begin(), 2), 2u);
+  EXPECT_EQ(out[0], "three");
+  EXPECT_EQ(out[1], "two");
+  EXPECT_EQ(myStack.pop_n(out.begin() + 2, 3), 1u);
+  EXPECT_EQ(out[2], "one");
+  EXPECT_TRUE(myStack.empty());
+  EXPECT_EQ(myStack.pop_n(out.begin(), 3), 0u);
+  EXPECT_FALSE(myStack.try_pop().has_value());
+  EXPECT_THROW(myStack.pop_value(), std::out_of_range);
+}
+
+TEST(StackPopValueTest, vector_list_and_std_vector) {
+  CheckStackPopValue<mycontainers::vector<std::string>>();
+  CheckStackPopValue<mycontainers::list<std::string>>();
+  CheckStackPopValue<std::vector<std::string>>();
+
+  mycontainers::vector<int> items{1, 2, 3};
+  mycontainers::MyStack<int> stack{0};
+  stack.push_range(items.begin(), items.end());
+  EXPECT_EQ(stack.size(), 4u);
+  EXPECT_EQ(stack.top(), 3);
+}
+
+// The default backend owns raw storage, so the element needs no default
+// constructor and pop destroys it at once.
+struct NoDefaultCtor {
+  explicit NoDefaultCtor(int v) : value(v) {}
+  int value;
+};
+
+TEST(StackDefaultContainerTest, pop_destroys_element) {
+  mycontainers::MyStack<NoDefaultCtor> values;
+  values.push(NoDefaultCtor(1));
+  values.push(NoDefaultCtor(2));
+  EXPECT_EQ(values.top().value, 2);
+  values.pop();
+  EXPECT_EQ(values.top().value, 1);
+
+  auto owned = std::make_shared<int>(7);
+  mycontainers::MyStack<std::shared_ptr<int>> stack;
+  stack.push(owned);
+  stack.push(owned);
+  EXPECT_EQ(owned.use_count(), 3);
+  stack.pop();
+  EXPECT_EQ(owned.use_count(), 2);
+  stack.pop();
+  EXPECT_EQ(owned.use_count(), 1);
+}
+
+// A vector that records the capacities requested from it.
+struct ReserveRecordingVector : std::vector<int> {
+  void reserve(size_t n) {
+    reserved->push_back(n);
+    std::vector<int>::reserve(n);
+  }
+  std::vector<size_t> *reserved;
+};
+
+TEST(StackPushRangeTest, reserves_for_forward_iterators) {
+  std::vector<size_t> reserved;
+  ReserveRecordingVector container;
+  container.reserved = &reserved;
+  mycontainers::MyStack<int, ReserveRecordingVector> stack(container);
+  stack.push(0);
+  std::list<int> items{1, 2, 3, 4};
+  stack.push_range(items.begin(), items.end());
+  EXPECT_EQ(reserved, std::vector<size_t>{5});
+  // An input range can be walked only once, so it is not counted.
+  std::istringstream input("5 6");
+  stack.push_range(std::istream_iterator<int>(input),
+                   std::istream_iterator<int>());
+  EXPECT_EQ(reserved.size(), 1u);
+  EXPECT_EQ(stack.size(), 7u);
+  EXPECT_EQ(stack.top(), 6);
+}
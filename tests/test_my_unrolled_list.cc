@@ -0,0 +1,232 @@
+#include <list>
+#include <random>
+#include <string>
+
+#include "../my_unrolled_list.h"
+#include "gtest/gtest.h"
+
+template <class T, std::size_t B>
+static void ExpectSameList(const std::list<T> &stdList,
+                           const mycontainers::unrolled_list<T, B> &myList) {
+  ASSERT_EQ(stdList.size(), myList.size());
+  ASSERT_EQ(stdList.empty(), myList.empty());
+  auto myIt = myList.cbegin();
+  for (const T &value : stdList) {
+    ASSERT_EQ(value, *myIt);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myList.cend());
+  auto stdRit = stdList.end();
+  auto myRit = myList.end();
+  while (stdRit != stdList.begin()) {
+    --stdRit;
+    --myRit;
+    ASSERT_EQ(*stdRit, *myRit);
+  }
+}
+
+template <std::size_t B>
+static void RandomOperations(unsigned seed) {
+  std::list<int> stdList;
+  mycontainers::unrolled_list<int, B> myList;
+  std::mt19937 gen(seed);
+  for (int i = 0; i < 3000; ++i) {
+    int op = gen() % 8;
+    int value = gen() % 1000;
+    size_t offset = stdList.empty() ? 0 : gen() % (stdList.size() + 1);
+    auto stdIt = stdList.begin();
+    auto myIt = myList.begin();
+    for (size_t k = 0; k < offset; ++k, ++stdIt, ++myIt) {
+    }
+    if (op < 2) {
+      myList.push_back(value);
+      stdList.push_back(value);
+    } else if (op < 4) {
+      myList.push_front(value);
+      stdList.push_front(value);
+    } else if (op < 6) {
+      auto inserted = myList.insert(myIt, value);
+      stdList.insert(stdIt, value);
+      ASSERT_EQ(*inserted, value);
+    } else if (stdIt != stdList.end()) {
+      auto next = myList.erase(myIt);
+      auto stdNext = stdList.erase(stdIt);
+      if (stdNext != stdList.end()) {
+        ASSERT_EQ(*stdNext, *next);
+      } else {
+        ASSERT_TRUE(next == myList.end());
+      }
+    } else if (!stdList.empty()) {
+      myList.pop_back();
+      stdList.pop_back();
+      myList.pop_front();
+      if (!stdList.empty()) stdList.pop_front();
+    }
+    if (i % 100 == 0) ExpectSameList(stdList, myList);
+  }
+  ExpectSameList(stdList, myList);
+}
+
+TEST(unrolled_list, constructor) {
+  mycontainers::unrolled_list<std::string> myList;
+  std::list<std::string> stdList;
+  ExpectSameList(stdList, myList);
+
+  mycontainers::unrolled_list<int, 4> mySized(10);
+  ExpectSameList(std::list<int>(10), mySized);
+
+  mycontainers::unrolled_list<int, 4> myItems{1, 2, 3, 4, 5, 6, 7};
+  std::list<int> stdItems{1, 2, 3, 4, 5, 6, 7};
+  ExpectSameList(stdItems, myItems);
+
+  mycontainers::unrolled_list<int, 4> myCopy(myItems);
+  ExpectSameList(stdItems, myCopy);
+  mycontainers::unrolled_list<int, 4> myMoved(std::move(myCopy));
+  ExpectSameList(stdItems, myMoved);
+  ASSERT_TRUE(myCopy.empty());
+
+  myCopy = myMoved;
+  ExpectSameList(stdItems, myCopy);
+  mySized = std::move(myCopy);
+  ExpectSameList(stdItems, mySized);
+  ASSERT_EQ(mySized.front(), 1);
+  ASSERT_EQ(mySized.back(), 7);
+}
+
+TEST(unrolled_list, random_operations) {
+  RandomOperations<1>(1);
+  RandomOperations<2>(2);
+  RandomOperations<3>(3);
+  RandomOperations<8>(4);
+  RandomOperations<32>(5);
+}
+
+TEST(unrolled_list, insert_aliased_value) {
+  mycontainers::unrolled_list<std::string, 2> myList{"a", "b"};
+  myList.insert(myList.begin(), myList.back());
+  myList.push_back(myList.front());
+  ExpectSameList(std::list<std::string>{"b", "a", "b", "b"}, myList);
+}
+
+// Movable only, so the list must never fall back to a copy.
+struct MoveOnly {
+  explicit MoveOnly(int v) : value(v) {}
+  MoveOnly(MoveOnly &&other) noexcept : value(other.value) {}
+  MoveOnly &operator=(MoveOnly &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  bool operator<(const MoveOnly &other) const { return value < other.value; }
+
+  int value;
+};
+
+TEST(unrolled_list, move_only_values) {
+  mycontainers::unrolled_list<MoveOnly, 2> myList;
+  mycontainers::unrolled_list<MoveOnly, 2> myOther;
+  for (int i : {8, 2, 6}) myList.push_back(MoveOnly(i));
+  myList.push_front(MoveOnly(4));
+  myList.insert(++myList.begin(), MoveOnly(10));
+  myList.sort();
+  myList.front().value = 0;
+  myList.back().value = 12;
+  for (int i : {1, 7, 13}) myOther.push_back(MoveOnly(i));
+  myList.merge(myOther);
+  ASSERT_TRUE(myOther.empty());
+  std::list<int> stdList{0, 1, 4, 6, 7, 8, 12, 13};
+  auto myIt = myList.cbegin();
+  for (int value : stdList) {
+    ASSERT_EQ(myIt->value, value);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myList.cend());
+}
+
+// Ordered by key only, so the tag shows whether equal keys kept their order.
+struct Tagged {
+  bool operator<(const Tagged &other) const { return key < other.key; }
+  bool operator==(const Tagged &other) const {
+    return key == other.key && tag == other.tag;
+  }
+
+  int key;
+  int tag;
+};
+
+TEST(unrolled_list, sort_is_stable) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> keys(0, 50);
+  std::list<Tagged> stdList;
+  mycontainers::unrolled_list<Tagged, 8> myList;
+  for (int i = 0; i < 3000; ++i) {
+    Tagged value{keys(gen), i};
+    stdList.push_back(value);
+    myList.push_back(value);
+  }
+  stdList.sort();
+  myList.sort();
+  auto myIt = myList.cbegin();
+  for (const Tagged &value : stdList) {
+    ASSERT_TRUE(*myIt == value);
+    ++myIt;
+  }
+  ASSERT_TRUE(myIt == myList.cend());
+}
+
+TEST(unrolled_list, clear_and_swap) {
+  mycontainers::unrolled_list<int, 4> myFirst{1, 2, 3, 4, 5};
+  mycontainers::unrolled_list<int, 4> mySecond;
+  myFirst.swap(mySecond);
+  ASSERT_TRUE(myFirst.empty());
+  ExpectSameList(std::list<int>{1, 2, 3, 4, 5}, mySecond);
+  mySecond.clear();
+  ASSERT_TRUE(mySecond.empty());
+  mySecond.push_back(9);
+  ExpectSameList(std::list<int>{9}, mySecond);
+}
+
+TEST(unrolled_list, splice) {
+  for (size_t offset = 0; offset <= 9; ++offset) {
+    std::list<int> stdList{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::list<int> stdOther{10, 11, 12, 13, 14};
+    mycontainers::unrolled_list<int, 4> myList{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    mycontainers::unrolled_list<int, 4> myOther{10, 11, 12, 13, 14};
+    auto stdIt = stdList.begin();
+    auto myIt = myList.cbegin();
+    for (size_t k = 0; k < offset; ++k, ++stdIt, ++myIt) {
+    }
+    stdList.splice(stdIt, stdOther);
+    myList.splice(myIt, myOther);
+    ExpectSameList(stdList, myList);
+    ASSERT_TRUE(myOther.empty());
+  }
+}
+
+TEST(unrolled_list, merge_sort_unique_reverse) {
+  std::list<int> stdList{5, 3, 3, 9, 1, 1, 1, 7, 3};
+  std::list<int> stdOther{2, 4, 4, 8};
+  mycontainers::unrolled_list<int, 4> myList{5, 3, 3, 9, 1, 1, 1, 7, 3};
+  mycontainers::unrolled_list<int, 4> myOther{2, 4, 4, 8};
+  stdList.sort();
+  myList.sort();
+  ExpectSameList(stdList, myList);
+  stdList.merge(stdOther);
+  myList.merge(myOther);
+  ExpectSameList(stdList, myList);
+  ASSERT_TRUE(myOther.empty());
+  stdList.unique();
+  myList.unique();
+  ExpectSameList(stdList, myList);
+  stdList.reverse();
+  myList.reverse();
+  ExpectSameList(stdList, myList);
+}
+
+TEST(unrolled_list, insert_many) {
+  mycontainers::unrolled_list<int, 2> myList{1, 5};
+  auto it = myList.insert_many(++myList.cbegin(), 2, 3, 4);
+  ASSERT_EQ(*it, 4);
+  myList.insert_many_back(6, 7);
+  myList.insert_many_front(-1, 0);
+  ExpectSameList(std::list<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7}, myList);
+}
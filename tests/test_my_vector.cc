@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "../my_array.h"
 #include "../my_vector.h"
 #include "gtest/gtest.h"
 
@@ -280,3 +285,99 @@ TEST(vector, pop_back) {
     ++stdit;
   }
 }
+
+TEST(vector, remove_if_elements) {
+  mycontainers::vector<int> myVector{5, 1, 8, 2, 9, 9, 3, 7};
+  std::vector<int> stdVector{8, 2};
+  ASSERT_EQ(myVector.remove_if([](int value) { return value % 2 != 0; }), 6U);
+  ASSERT_EQ(myVector.size(), stdVector.size());
+  ASSERT_EQ(myVector.capacity(), 8U);
+  for (size_t i = 0; i < stdVector.size(); ++i) {
+    ASSERT_EQ(myVector[i], stdVector[i]);
+  }
+  myVector.insert_many_back(2, 6, 2);
+  ASSERT_EQ(mycontainers::erase_if(myVector, [](int v) { return v > 7; }), 1U);
+  ASSERT_EQ(myVector.remove(myVector[0]), 3U);
+  ASSERT_EQ(myVector.size(), 1U);
+  ASSERT_EQ(myVector[0], 6);
+}
+
+TEST(vector, remove_if_throwing_predicate) {
+  mycontainers::vector<int> myVector{1, 2, 3, 4, 5};
+  std::vector<int> stdVector{2, 3, 4, 5};
+  auto pred = [](int value) {
+    if (value == 3) throw std::runtime_error("stop");
+    return value == 1;
+  };
+  ASSERT_THROW(myVector.remove_if(pred), std::runtime_error);
+  ASSERT_EQ(myVector.size(), stdVector.size());
+  for (size_t i = 0; i < stdVector.size(); ++i) {
+    ASSERT_EQ(myVector[i], stdVector[i]);
+  }
+}
+
+TEST(vector, unique_predicate) {
+  mycontainers::vector<int> myVector{1, 1, 2, 4, 3, 10, 11, 20, 20};
+  std::vector<int> stdVector{1, 1, 2, 4, 3, 10, 11, 20, 20};
+  stdVector.erase(std::unique(stdVector.begin(), stdVector.end()),
+                  stdVector.end());
+  ASSERT_EQ(myVector.unique(), 2U);
+  ASSERT_EQ(myVector.size(), stdVector.size());
+  for (size_t i = 0; i < stdVector.size(); ++i) {
+    ASSERT_EQ(myVector[i], stdVector[i]);
+  }
+  auto close = [](int first, int value) { return value - first < 3; };
+  stdVector.erase(std::unique(stdVector.begin(), stdVector.end(), close),
+                  stdVector.end());
+  ASSERT_EQ(myVector.unique(close), 3U);
+  ASSERT_EQ(myVector.size(), stdVector.size());
+  for (size_t i = 0; i < stdVector.size(); ++i) {
+    ASSERT_EQ(myVector[i], stdVector[i]);
+  }
+}
+
+#if __cplusplus >= 202002L
+// The vector serves as scratch space; only the array outlives the
+// constant evaluation.
+constexpr mycontainers::array<int, 8> FirstPrimes() {
+  mycontainers::vector<int> primes;
+  for (int n = 2; primes.size() < 8; ++n) {
+    bool prime = true;
+    for (auto it = primes.begin(); it != primes.end(); ++it) {
+      if (n % *it == 0) prime = false;
+    }
+    if (prime) primes.push_back(n);
+  }
+  mycontainers::vector<int> copy(primes);
+  copy.insert_many_back(0, 0);
+  copy.remove(0);
+  mycontainers::array<int, 8> result{};
+  for (size_t i = 0; i < copy.size(); ++i) result[i] = copy[i];
+  return result;
+}
+
+// An empty vector and one shrunk back to nothing own no storage, so both
+// must free everything they allocated before the evaluation ends.
+constexpr size_t EmptyAndShrunk() {
+  mycontainers::vector<int> empty;
+  empty.shrink_to_fit();
+  mycontainers::vector<int> sized(0);
+  mycontainers::vector<int> shrunk{1, 2, 3};
+  shrunk.reserve(16);
+  shrunk.clear();
+  shrunk.shrink_to_fit();
+  return empty.capacity() + sized.capacity() + shrunk.capacity();
+}
+
+TEST(vector, constexpr_empty_storage) {
+  static_assert(EmptyAndShrunk() == 0);
+  ASSERT_EQ(EmptyAndShrunk(), 0U);
+}
+
+TEST(vector, constexpr_scratch) {
+  constexpr mycontainers::array<int, 8> primes = FirstPrimes();
+  static_assert(primes == mycontainers::array<int, 8>{2, 3, 5, 7, 11, 13,
+                                                      17, 19});
+  ASSERT_EQ(primes.back(), 19);
+}
+#endif
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "../my_work_stealing_deque.h"
+#include "gtest/gtest.h"
+
+using IntDeque = mycontainers::work_stealing_deque<int>;
+
+TEST(work_stealing_deque, owner_and_thief_ends) {
+  IntDeque myDeque(4);
+  std::deque<int> stdDeque;
+  EXPECT_EQ(myDeque.capacity(), 4u);
+  EXPECT_TRUE(myDeque.empty());
+  int value = 0;
+  EXPECT_FALSE(myDeque.pop(value));
+  EXPECT_FALSE(myDeque.steal(value));
+  // Pops take the newest element and steals the oldest; pushes past the
+  // capacity grow the buffer with the elements wrapped around its end.
+  for (int i = 0; i < 100; ++i) {
+    myDeque.push(i);
+    stdDeque.push_back(i);
+    if (i % 3 == 1) {
+      ASSERT_TRUE(myDeque.pop(value));
+      ASSERT_EQ(value, stdDeque.back());
+      stdDeque.pop_back();
+    }
+    if (i % 5 == 4) {
+      ASSERT_TRUE(myDeque.steal(value));
+      ASSERT_EQ(value, stdDeque.front());
+      stdDeque.pop_front();
+    }
+    ASSERT_EQ(myDeque.size(), stdDeque.size());
+  }
+  EXPECT_EQ(myDeque.capacity(), 64u);
+  while (myDeque.pop(value)) {
+    ASSERT_EQ(value, stdDeque.back());
+    stdDeque.pop_back();
+  }
+  EXPECT_TRUE(stdDeque.empty());
+  EXPECT_TRUE(myDeque.empty());
+}
+
+// The owner keeps pushing and popping while thieves steal; every element
+// must be taken exactly once.
+TEST(work_stealing_deque, threads_take_each_element_once) {
+  IntDeque myDeque(2);
+  const int kCount = 100000;
+  const int kThieves = 3;
+  std::vector<std::atomic<int>> taken(kCount);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int value;
+      while (!done.load()) {
+        if (myDeque.steal(value)) {
+          ++taken[value];
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < kCount; ++i) {
+    myDeque.push(i);
+    if (i % 3 == 0 && myDeque.pop(value)) ++taken[value];
+  }
+  while (myDeque.pop(value)) ++taken[value];
+  while (!myDeque.empty()) std::this_thread::yield();
+  done = true;
+  for (auto &thread : thieves) thread.join();
+  int wrong = 0;
+  for (auto &count : taken) wrong += count.load() != 1;
+  EXPECT_EQ(wrong, 0);
+}